@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/fusion/include/at_key.hpp>
+#include <boost/fusion/include/map.hpp>
+
+
+template <int i>
+struct x { };
+
+int main() {
+    using map_t = boost::fusion::map<
+        <%= (1..input_size).map { |n|
+            "boost::fusion::pair<x<#{n}>, int>"
+        }.join(', ') %>
+    >;
+    map_t map{};
+
+    <% (1..input_size).each do |n| %>
+        int result_<%= n %> = boost::fusion::at_key<x<<%= n %>>>(map);
+        (void)result_<%= n %>;
+    <% end %>
+}
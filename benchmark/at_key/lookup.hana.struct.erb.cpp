@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+struct Struct {
+    BOOST_HANA_DEFINE_STRUCT(Struct<%= (1..input_size).map { |n| ",\n        (x<#{n}>, k#{n})" }.join %>
+    );
+};
+
+int main() {
+    Struct s{};
+
+    <% (1..input_size).each do |n| %>
+        auto result_<%= n %> = hana::at_key(s, <%= hana_string("k#{n}") %>);
+        (void)result_<%= n %>;
+    <% end %>
+}
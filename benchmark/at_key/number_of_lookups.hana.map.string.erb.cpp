@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr auto map = hana::make_map(
+        <%= (1..env[:map_size]).map { |n|
+            "hana::make_pair(#{hana_string("k#{n}")}, x<#{n}>{})"
+        }.join(', ') %>
+    );
+    (void)map;
+
+    <% (1..input_size).each do |n| k = (n - 1) % env[:map_size] + 1 %>
+        constexpr auto result_<%= n %> = hana::at_key(map, <%= hana_string("k#{k}") %>);
+        (void)result_<%= n %>;
+    <% end %>
+}
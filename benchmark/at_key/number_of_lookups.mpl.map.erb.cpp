@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+
+
+template <int i>
+struct x { };
+
+using map = <%= mpl_map((1..env[:map_size]).map { |n| "boost::mpl::pair<x<#{n}>, x<#{n}>>" }) %>;
+
+<% (1..input_size).each do |n| k = (n - 1) % env[:map_size] + 1 %>
+    using result_<%= n %> = boost::mpl::at<map, x<<%= k %>>>::type;
+<% end %>
+
+int main() { }
@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/chunked_for_each.hpp>
+#include <boost/hana/range.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::experimental::chunked_for_each<1>(boost::hana::range_c<int, 0, <%= input_size %>>, [&](int i) {
+                result = result * 31 + std::rand() % (i + 1);
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
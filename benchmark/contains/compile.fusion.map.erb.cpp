@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/fusion/include/has_key.hpp>
+#include <boost/fusion/include/map.hpp>
+
+
+template <int i>
+struct x { };
+
+using map = boost::fusion::map<
+    <%= (1..input_size).map { |n|
+        "boost::fusion::pair<x<#{n}>, int>"
+    }.join(', ') %>
+>;
+
+<% (1..input_size).each do |n| %>
+    static_assert(boost::fusion::result_of::has_key<map, x<<%= n %>>>::value, "");
+<% end %>
+static_assert(!boost::fusion::result_of::has_key<map, x<0>>::value, "");
+
+int main() { }
@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+struct Struct {
+    BOOST_HANA_DEFINE_STRUCT(Struct<%= (1..input_size).map { |n| ",\n        (x<#{n}>, member#{n})" }.join %>
+    );
+};
+
+int main() {
+    constexpr auto accessors = hana::accessors<Struct>();
+    (void)accessors;
+}
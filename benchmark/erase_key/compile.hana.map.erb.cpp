@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr auto map_0 = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(hana::type_c<x<#{n}>>, x<#{n}>{})"
+        }.join(', ') %>
+    );
+    <% (1..input_size).each do |n| %>
+        constexpr auto map_<%= n %> = hana::erase_key(map_<%= n - 1 %>, hana::type_c<x<<%= n %>>>);
+    <% end %>
+    (void)map_<%= input_size %>;
+}
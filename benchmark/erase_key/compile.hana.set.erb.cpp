@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr auto set_0 = hana::make_set(
+        <%= (1..input_size).map { |n| "hana::type_c<x<#{n}>>" }.join(', ') %>
+    );
+    <% (1..input_size).each do |n| %>
+        constexpr auto set_<%= n %> = hana::erase_key(set_<%= n - 1 %>, hana::type_c<x<<%= n %>>>);
+    <% end %>
+    (void)set_<%= input_size %>;
+}
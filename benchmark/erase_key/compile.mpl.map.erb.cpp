@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/erase_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+
+
+template <int i>
+struct x { };
+
+using map_0 = <%= mpl_map((1..input_size).map { |n| "boost::mpl::pair<x<#{n}>, x<#{n}>>" }) %>;
+<% (1..input_size).each do |n| %>
+    using map_<%= n %> = boost::mpl::erase_key<map_<%= n - 1 %>, x<<%= n %>>>::type;
+<% end %>
+
+int main() { }
@@ -28,5 +28,6 @@ int main () {
                 return state + t;
             });
         }
+        hana::benchmark::do_not_optimize(result);
     });
 }
@@ -22,5 +22,6 @@ int main () {
                 return state + t;
             });
         }
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
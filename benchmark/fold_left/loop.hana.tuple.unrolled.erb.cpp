@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+// Make sure the algorithms are unrolled whatever the size of the tuple.
+#define BOOST_HANA_CONFIG_LOOP_THRESHOLD 100000
+
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::tuple<<%= (['double'] * input_size).join(', ') %>> values;
+            boost::hana::for_each(values, [](double& x) {
+                x = std::rand();
+            });
+
+            auto scaled = boost::hana::transform(values, [](double x) {
+                return x * 0.5;
+            });
+
+            result += boost::hana::fold_left(scaled, 0.0, [](double state, double x) {
+                return state + x;
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::array<double, <%= input_size %>> values;
+            for (double& x : values)
+                x = std::rand();
+
+            std::array<double, <%= input_size %>> scaled;
+            for (std::size_t i = 0; i != values.size(); ++i)
+                scaled[i] = values[i] * 0.5;
+
+            double sum = 0.0;
+            for (double x : scaled)
+                sum += x;
+            result += sum;
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
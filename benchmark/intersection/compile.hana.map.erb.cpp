@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr auto xs = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(hana::type_c<x<#{n}>>, x<#{n}>{})"
+        }.join(', ') %>
+    );
+    constexpr auto ys = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(hana::type_c<x<#{n + input_size / 2}>>, x<#{n}>{})"
+        }.join(', ') %>
+    );
+
+    constexpr auto result = hana::intersection(xs, ys);
+    (void)result;
+}
@@ -0,0 +1,75 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (std::string, name),
+        (std::string, email),
+        (int, id),
+        (int, age),
+        (double, balance),
+        (bool, active)
+    );
+};
+
+void from_json(std::istream& in, int& x) { in >> x; }
+void from_json(std::istream& in, double& x) { in >> x; }
+void from_json(std::istream& in, bool& b) {
+    in >> std::ws;
+    b = in.peek() == 't';
+    in.ignore(b ? 4 : 5);
+}
+void from_json(std::istream& in, std::string& s) {
+    char c;
+    in >> c;
+    s.clear();
+    while (in.get(c) && c != '"')
+        s += c;
+}
+
+// Like example/misc/from_json.cpp, this requires the keys to be in order.
+void from_json(std::istream& in, Record& record) {
+    char brace;
+    in >> brace;
+    boost::hana::for_each(boost::hana::keys(record), [&](auto key) {
+        in.ignore(std::numeric_limits<std::streamsize>::max(), ':');
+        from_json(in, boost::hana::at_key(record, key));
+    });
+    in >> brace;
+}
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{"name" + std::to_string(i), "user" + std::to_string(i) + "@example.com",
+                                 i, i % 100, i * 1.25, i % 2 == 0});
+    std::string json = boost::hana::experimental::to_json(records);
+    std::vector<Record> result;
+
+    boost::hana::benchmark::measure([&] {
+        std::istringstream in{json};
+        result.clear();
+        char c;
+        in >> c;
+        do {
+            result.emplace_back();
+            from_json(in, result.back());
+        } while (in >> c && c == ',');
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,61 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (std::string, name),
+        (std::string, email),
+        (int, id),
+        (int, age),
+        (double, balance),
+        (bool, active)
+    );
+};
+
+std::string quote(std::string const& s) { return "\"" + s + "\""; }
+std::string to_json(int x) { return std::to_string(x); }
+std::string to_json(double x) { return std::to_string(x); }
+std::string to_json(bool b) { return b ? "true" : "false"; }
+std::string to_json(std::string const& s) { return quote(s); }
+
+std::string to_json(Record const& record) {
+    std::string result = "{";
+    boost::hana::for_each(boost::hana::keys(record), [&](auto key) {
+        if (result.size() > 1)
+            result += ",";
+        result += quote(boost::hana::to<char const*>(key)) + ":"
+                + to_json(boost::hana::at_key(record, key));
+    });
+    return result + "}";
+}
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{"name" + std::to_string(i), "user" + std::to_string(i) + "@example.com",
+                                 i, i % 100, i * 1.25, i % 2 == 0});
+    std::string buffer;
+
+    boost::hana::benchmark::measure([&] {
+        buffer = "[";
+        for (Record const& record : records) {
+            if (buffer.size() > 1)
+                buffer += ",";
+            buffer += to_json(record);
+        }
+        buffer += "]";
+        boost::hana::benchmark::do_not_optimize(buffer);
+    });
+}
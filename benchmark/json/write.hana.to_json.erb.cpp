@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (std::string, name),
+        (std::string, email),
+        (int, id),
+        (int, age),
+        (double, balance),
+        (bool, active)
+    );
+};
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{"name" + std::to_string(i), "user" + std::to_string(i) + "@example.com",
+                                 i, i % 100, i * 1.25, i % 2 == 0});
+    std::string buffer;
+
+    boost::hana::benchmark::measure([&] {
+        buffer.clear();
+        boost::hana::experimental::to_json(buffer, records);
+        boost::hana::benchmark::do_not_optimize(buffer);
+    });
+}
@@ -0,0 +1,13 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/basic_tuple.hpp>
+
+
+int main() {
+    constexpr auto tuple = boost::hana::make_basic_tuple(
+        <%= (1..input_size).map { |n| "#{n}.0" }.join(', ') %>
+    );
+    (void)tuple;
+}
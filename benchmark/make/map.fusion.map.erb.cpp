@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/fusion/include/map.hpp>
+
+
+template <int i>
+struct x { };
+
+int main() {
+    boost::fusion::map<
+        <%= (1..input_size).map { |n|
+            "boost::fusion::pair<x<#{n}>, int>"
+        }.join(', ') %>
+    > map{};
+    (void)map;
+}
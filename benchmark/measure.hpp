@@ -5,24 +5,163 @@
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <iomanip>
 #include <iostream>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+#   if __has_include(<linux/perf_event.h>)
+#       define BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+#       include <linux/perf_event.h>
+#       include <sys/ioctl.h>
+#       include <sys/syscall.h>
+#       include <unistd.h>
+#   endif
+#endif
 
 
 namespace boost { namespace hana { namespace benchmark {
+    //! Forces the compiler to assume that `x` is read, so that the
+    //! computation of `x` can't be optimized away.
+    template <typename T>
+    inline void do_not_optimize(T const& x) {
+#if defined(__GNUC__) || defined(__clang__)
+        __asm__ __volatile__("" : : "g"(&x) : "memory");
+#else
+        static void const volatile* sink;
+        sink = &x;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    namespace detail {
+        using clock = std::chrono::steady_clock;
+        using seconds = std::chrono::duration<double>;
+
+        // Time spent running the function before measuring anything.
+        constexpr seconds warmup_time{0.1};
+
+        // Approximate time spent measuring; the number of samples is
+        // adjusted to fit in that time, but stays in the given bounds.
+        constexpr seconds measure_time{0.5};
+        constexpr std::size_t min_samples = 10;
+        constexpr std::size_t max_samples = 1000;
+
+        // Minimum duration of a sample. Functions faster than this are run
+        // several times per sample, to reduce the effect of the clock's
+        // resolution.
+        constexpr seconds min_sample_time{0.001};
+
+        // Counts the CPU cycles spent by the current thread in user mode,
+        // when the kernel lets us use `perf_event_open`.
+        struct cycle_counter {
+#ifdef BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+            cycle_counter() {
+                perf_event_attr attr{};
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                fd_ = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+            }
+
+            ~cycle_counter() { if (available()) ::close(fd_); }
+
+            bool available() const { return fd_ != -1; }
+
+            void start() {
+                ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+            }
+
+            long long stop() {
+                ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+                long long cycles = 0;
+                if (::read(fd_, &cycles, sizeof(cycles)) != sizeof(cycles))
+                    return 0;
+                return cycles;
+            }
+
+        private:
+            int fd_;
+#else
+            bool available() const { return false; }
+            void start() { }
+            long long stop() { return 0; }
+#endif
+        };
+
+        template <typename T>
+        T percentile(std::vector<T> const& sorted, double p) {
+            std::size_t i = static_cast<std::size_t>(p * (sorted.size() - 1) + 0.5);
+            return sorted[i];
+        }
+    }
+
+    //! Measures the execution time of `f()` and prints statistics about it.
+    //!
+    //! `f` is first run without being measured for some time to warm up the
+    //! caches and the branch predictors. The time taken by a single run is
+    //! then used to decide how many times `f` is run per sample, and how
+    //! many samples are taken. The minimum, median and 95th percentile of
+    //! the time taken by a single run of `f` are printed, along with the
+    //! median number of CPU cycles per run when they can be counted.
+    //!
+    //! The statistics are printed as a JSON object on a line of the form
+    //! `[execution statistics: {...}]`, which is read by `measure.rb`. For
+    //! convenience, the median is also printed as `[execution time: ...]`.
     auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
+        using namespace detail;
+
+        // Warm up, and estimate the time taken by a single run.
+        std::size_t runs = 0;
+        auto start = clock::now();
+        do {
             f();
+            ++runs;
+        } while (clock::now() - start < warmup_time);
+        seconds estimate = seconds{clock::now() - start} / runs;
+
+        std::size_t batch = std::max<std::size_t>(1,
+            static_cast<std::size_t>(min_sample_time / estimate));
+        std::size_t samples = std::min(max_samples, std::max(min_samples,
+            static_cast<std::size_t>(measure_time / (estimate * batch))));
+
+        cycle_counter counter;
+        std::vector<double> times, cycles;
+        times.reserve(samples);
+        cycles.reserve(samples);
+        for (std::size_t sample = 0; sample < samples; ++sample) {
+            counter.start();
+            auto sample_start = clock::now();
+            for (std::size_t i = 0; i < batch; ++i)
+                f();
+            auto sample_stop = clock::now();
+            long long sample_cycles = counter.stop();
+
+            times.push_back(seconds{sample_stop - sample_start}.count() / batch);
+            cycles.push_back(static_cast<double>(sample_cycles) / batch);
         }
-        auto stop = std::chrono::steady_clock::now();
+        std::sort(times.begin(), times.end());
+        std::sort(cycles.begin(), cycles.end());
 
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
+        std::cout << std::setprecision(9);
+        std::cout << "[execution statistics: {"
+                  << "\"samples\": " << samples << ", "
+                  << "\"batch\": " << batch << ", "
+                  << "\"min\": " << times.front() << ", "
+                  << "\"median\": " << percentile(times, 0.5) << ", "
+                  << "\"p95\": " << percentile(times, 0.95);
+        if (counter.available())
+            std::cout << ", \"cycles\": " << percentile(cycles, 0.5);
+        std::cout << "}]" << std::endl;
+        std::cout << "[execution time: " << percentile(times, 0.5) << "]" << std::endl;
     };
 }}}
 
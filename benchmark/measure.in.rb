@@ -6,8 +6,13 @@
 #
 #
 # When called as a program, this script runs the command line given in
-# arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# arguments and returns the total time, along with the peak resident memory
+# used by the processes it spawned. This is similar to the `time` command
+# from Bash.
+#
+# If the command line contains `-ftime-trace` (Clang only), the time spent in
+# each template instantiation is also read from the trace file written by the
+# compiler, aggregated by Hana entity, and returned as a JSON object.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +21,8 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'fiddle'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -72,6 +79,24 @@ def fusion_list(values)
   }
 end
 
+# pairs : A sequence of strings representing `boost::mpl::pair`s to put in the mpl::map.
+# Using this method requires including
+#   - <boost/mpl/map.hpp>
+#   - <boost/mpl/insert.hpp>
+def mpl_map(pairs)
+  fast, rest = split_at(20, pairs)
+  rest.inject("boost::mpl::map#{fast.length}<#{fast.join(', ')}>") { |m, p|
+    "boost::mpl::insert<#{m}, #{p}>::type"
+  }
+end
+
+# Returns a string representing a `hana::string` containing the characters
+# of the given Ruby string. Using this method requires including
+#   - <boost/hana/string.hpp>
+def hana_string(s)
+  "boost::hana::string_c<#{s.chars.map { |c| "'#{c}'" }.join(', ')}>"
+end
+
 # Turns a CMake-style boolean into a Ruby boolean.
 def cmake_bool(b)
   return true if b.is_a? String and ["true", "yes", "1"].include?(b.downcase)
@@ -79,7 +104,79 @@ def cmake_bool(b)
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
+# Returns the maximum resident set size (in kilobytes) of the largest child
+# process that was waited for by this process, recursively. When measuring
+# a compilation, this is the peak memory of the compiler proper (e.g. cc1plus),
+# not of the driver.
+def peak_children_memory
+  getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  usage = Fiddle::Pointer.malloc(256)
+  rusage_children = -1
+  raise "getrusage failed" unless getrusage.call(rusage_children, usage).zero?
+
+  # ru_maxrss comes right after the two `struct timeval`s of `struct rusage`
+  # and is expressed in bytes on OS X, but in kilobytes everywhere else.
+  offset = 2 * 2 * Fiddle::SIZEOF_LONG
+  maxrss = usage[offset, Fiddle::SIZEOF_LONG].unpack1('l!')
+  RUBY_PLATFORM =~ /darwin/ ? maxrss / 1024 : maxrss
+end
+
+# Strips the template arguments from a (possibly nested) C++ name, so that
+# all the specializations of a template are grouped together. For example,
+# `boost::hana::detail::ebo<bti<0>, int, false>` becomes
+# `boost::hana::detail::ebo`.
+def strip_template_arguments(name)
+  depth = 0
+  name.each_char.select { |c|
+    depth += 1 if c == '<'
+    keep = depth == 0
+    depth -= 1 if c == '>' && depth > 0
+    keep
+  }.join
+end
+
+# Returns a Hash mapping each Hana entity to the time (in seconds) spent
+# instantiating its specializations, given a trace file produced by Clang's
+# `-ftime-trace`. Instantiations are nested inside each other in the trace,
+# so only the time spent in an instantiation itself (and not in the nested
+# ones) is attributed to an entity. Entities outside of `boost::hana` are
+# all attributed to `other`.
+def instantiation_times(trace_file)
+  events = JSON.parse(File.read(trace_file))['traceEvents'].select { |e|
+    e['ph'] == 'X' && ['InstantiateClass', 'InstantiateFunction'].include?(e['name'])
+  }.sort_by { |e| [e['ts'], -e['dur']] }
+
+  entity = -> (event) {
+    name = strip_template_arguments(event['args']['detail'])
+    name.start_with?('boost::hana::') ? name : 'other'
+  }
+
+  times = Hash.new(0)
+  enclosing = []
+  events.each do |e|
+    enclosing.pop while !enclosing.empty? &&
+                        enclosing.last['ts'] + enclosing.last['dur'] <= e['ts']
+    times[entity[enclosing.last]] -= e['dur'] unless enclosing.empty?
+    times[entity[e]] += e['dur']
+    enclosing.push(e)
+  end
+  times.transform_values { |us| us.to_f / 1e6 }
+end
+
+# Results of compiling a given template with a given input size, so that
+# measuring different aspects of the same compilation (e.g. :compilation_time
+# and :memory) only requires compiling it once.
+COMPILATIONS = {}
+
+# Aspects that require running the benchmark. :execution_time is the median
+# of the time taken by the function given to `measure` in `measure.hpp`, and
+# :cycles is the median of the number of CPU cycles it takes.
+EXECUTION_ASPECTS = [:execution_time, :execution_min, :execution_p95, :cycles]
+
+# aspect must be one of :compilation_time, :memory, :instantiations, :bloat,
+# or one of the EXECUTION_ASPECTS
 def measure(aspect, template_relative, range, env = {})
   measure_file = Pathname.new("#{MEASURE_FILE}")
   template = Pathname.new(template_relative).expand_path
@@ -99,6 +196,12 @@ def measure(aspect, template_relative, range, env = {})
                                 total: range.size,
                                 output: STDERR)
   range.map do |n|
+    key = [template.to_s, n, env]
+    if COMPILATIONS.fetch(key, {}).key?(aspect)
+      progress.increment
+      next [n, COMPILATIONS[key][aspect]]
+    end
+
     # Evaluate the ERB template with the given environment, and save
     # the result in the `measure.cpp` file.
     code = Tilt::ERBTemplate.new(template).render(nil, input_size: n, env: env)
@@ -110,6 +213,8 @@ def measure(aspect, template_relative, range, env = {})
     stdout, stderr, status = make["#{MEASURE_TARGET}"]
     raise "compilation error: #{stdout}\n\n#{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
+    memory = stdout.match(/\[peak memory: (.+)\]/i)
+    instantiations = stdout.match(/\[instantiations: (.+)\]/i)
     # Size of the generated executable in KB
     size = File.size("@CMAKE_CURRENT_BINARY_DIR@/#{MEASURE_TARGET}").to_f / 1000
 
@@ -117,24 +222,43 @@ def measure(aspect, template_relative, range, env = {})
     # did not have the time to see the changes to the measure file and
     # the target was not rebuilt. So we sleep for a bit and then retry
     # this iteration.
-    (sleep 0.2; redo) if ctime.nil?
-    stat = ctime.captures[0].to_f if aspect == :compilation_time
-    stat = size if aspect == :bloat
+    (sleep 0.2; redo) if ctime.nil? || memory.nil?
+    stats = COMPILATIONS[key] = {
+      compilation_time: ctime.captures[0].to_f,
+      # Peak memory of the compiler in MB
+      memory: memory.captures[0].to_f / 1000,
+      bloat: size
+    }
+    if instantiations
+      stats[:instantiations] = JSON.parse(instantiations.captures[0])
+    elsif aspect == :instantiations
+      raise "Could not find [instantiations: ...] bit in the output. " +
+            "Was the benchmark compiled with -ftime-trace?"
+    end
 
     # Run the resulting program and get timing statistics. The statistics
     # should be written to stdout by the `measure` function of the
     # `measure.hpp` header.
-    if aspect == :execution_time
+    if EXECUTION_ASPECTS.include?(aspect)
       stdout, stderr, status = make["#{MEASURE_TARGET}.run"]
       raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
-      match = stdout.match(/\[execution time: (.+)\]/i)
+      match = stdout.match(/\[execution statistics: (.+)\]/i)
       if match.nil?
-        raise ("Could not find [execution time: ...] bit in the output. " +
+        raise ("Could not find [execution statistics: ...] bit in the output. " +
                "Did you use the `measure` function in the `measure.hpp` header? " +
                "stdout follows:\n#{stdout}")
       end
-      stat = match.captures[0].to_f
+      execution = JSON.parse(match.captures[0])
+      stats[:execution_time] = execution['median']
+      stats[:execution_min] = execution['min']
+      stats[:execution_p95] = execution['p95']
+      stats[:cycles] = execution['cycles'] if execution.key?('cycles')
+      if aspect == :cycles && !stats.key?(:cycles)
+        raise "CPU cycles can't be counted on this system (perf_event_open " +
+              "is unavailable or not permitted)."
+      end
     end
+    stat = stats[aspect]
 
     progress.increment
     [n, stat]
@@ -152,10 +276,44 @@ def time_compilation(erb_file, range, env = {})
   measure(:compilation_time, erb_file, range, env)
 end
 
+def memory_usage(erb_file, range, env = {})
+  measure(:memory, erb_file, range, env)
+end
+
+# Returns a JSON array of series suitable for a stacked column chart whose
+# categories are the input sizes in `range`. Each series is the time spent
+# instantiating one of the `entities` most costly Hana entities, for every
+# input size. The time spent in all the remaining entities is gathered in a
+# single `other` series.
+def instantiation_breakdown(erb_file, range, entities = 10, env = {})
+  data = measure(:instantiations, erb_file, range, env)
+  totals = Hash.new(0)
+  data.each { |_, times| times.each { |name, t| totals[name] += t } }
+  top = totals.keys.reject { |name| name == 'other' }
+                   .sort_by { |name| -totals[name] }
+                   .first(entities)
+
+  series = top.map { |entity|
+    { name: entity, data: data.map { |_, times| times.fetch(entity, 0) } }
+  }
+  series << { name: 'other', data: data.map { |_, times|
+    times.reject { |name, _| top.include?(name) }.values.sum
+  }}
+  JSON.generate(series)
+end
+
 if __FILE__ == $0
   command = ARGV.join(' ')
   time = Benchmark.realtime { `#{command}` }
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+  puts "[peak memory: #{peak_children_memory}]"
+
+  if ARGV.include?('-ftime-trace')
+    # Clang writes the trace next to the object file, replacing its extension.
+    object = ARGV[ARGV.index('-o') + 1]
+    trace = File.join(File.dirname(object), File.basename(object, '.*') + '.json')
+    puts "[instantiations: #{JSON.generate(instantiation_times(trace))}]"
+  end
 end
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/forward_members.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+
+
+struct Struct {
+    BOOST_HANA_DEFINE_STRUCT(Struct<%= (1..input_size).map { |n| ",\n        (std::string, member#{n})" }.join %>
+    );
+};
+
+int main () {
+    Struct s{<%= (1..input_size).map { |n| "std::string(100, 'a')" }.join(', ') %>};
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::for_each(boost::hana::forward_members(s), [&](auto const& member) {
+                result += member.size();
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <tuple>
+#include <vector>
+
+
+using Record = std::tuple<char, double, char, int>;
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{'a', 1.0 * i, 'b', i});
+
+    boost::hana::benchmark::measure([&] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (auto const& record : records)
+                result += std::get<1>(record) + std::get<3>(record);
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
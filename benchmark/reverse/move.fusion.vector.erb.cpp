@@ -27,7 +27,7 @@ int main () {
             );
 
             auto result = fusion::as_vector(fusion::reverse(std::move(values)));
-            (void)result;
+            hana::benchmark::do_not_optimize(result);
         }
     });
 }
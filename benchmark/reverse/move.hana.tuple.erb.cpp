@@ -21,7 +21,7 @@ int main () {
             );
 
             auto result = hana::reverse(std::move(values));
-            (void)result;
+            hana::benchmark::do_not_optimize(result);
         }
     });
 }
@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (int, flags),
+        (double, x),
+        (double, y),
+        (double, z),
+        (float, weight),
+        (float, score)
+    );
+};
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{i, i % 7, 1.0 * i, 2.0 * i, 3.0 * i, 0.5f, 1.5f});
+    std::vector<Record> result;
+
+    boost::hana::benchmark::measure([&] {
+        std::string buffer;
+        std::uint64_t size = records.size();
+        buffer.append(reinterpret_cast<char const*>(&size), sizeof size);
+        for (Record const& record : records) {
+            boost::hana::for_each(boost::hana::accessors<Record>(), [&](auto const& accessor) {
+                auto const& member = boost::hana::second(accessor)(record);
+                buffer.append(reinterpret_cast<char const*>(&member), sizeof member);
+            });
+        }
+
+        char const* first = buffer.data();
+        std::memcpy(&size, first, sizeof size);
+        first += sizeof size;
+        result.resize(size);
+        for (Record& record : result) {
+            boost::hana::for_each(boost::hana::accessors<Record>(), [&](auto const& accessor) {
+                auto& member = boost::hana::second(accessor)(record);
+                std::memcpy(&member, first, sizeof member);
+                first += sizeof member;
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (int, flags),
+        (double, x),
+        (double, y),
+        (double, z),
+        (float, weight),
+        (float, score)
+    );
+};
+
+int main () {
+    std::vector<Record> records;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        records.push_back(Record{i, i % 7, 1.0 * i, 2.0 * i, 3.0 * i, 0.5f, 1.5f});
+    std::vector<Record> result;
+
+    boost::hana::benchmark::measure([&] {
+        std::string buffer = boost::hana::experimental::serialize(records);
+        boost::hana::experimental::buffer_reader reader{buffer};
+        boost::hana::experimental::deserialize(reader, result);
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+
+#include "measure.hpp"
+#include <vector>
+
+
+struct Particle {
+    BOOST_HANA_DEFINE_STRUCT(Particle,
+        (double, x), (double, y), (double, z),
+        (double, vx), (double, vy), (double, vz),
+        (double, mass), (int, id)
+    );
+};
+
+int main () {
+    std::vector<Particle> particles;
+    for (int i = 0; i < <%= input_size %> * 1000; ++i)
+        particles.push_back(Particle{1.0 * i, 2.0 * i, 3.0 * i, 0.1, 0.2, 0.3, 1.5, i});
+
+    boost::hana::benchmark::measure([&] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            for (Particle const& p : particles)
+                result += p.x + p.y + p.z + p.vx + p.vy + p.vz + p.mass + p.id;
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/less.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/sort.hpp>
+
+// Sorting with anything but `hana::less` goes through the generic sort,
+// which instantiates the predicate for every comparison.
+struct pred {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const
+    { return boost::hana::less(x, y); }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle.map { |n| "boost::hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::sort(tuple, pred{});
+    (void)result;
+}
@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sort_by_key.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int i>
+struct x { };
+
+struct key {
+    template <int i>
+    constexpr auto operator()(boost::hana::basic_type<x<i>>) const
+    { return boost::hana::int_c<i>; }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle.map { |n| "boost::hana::type_c<x<#{n}>>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::sort_by_key(tuple, key{});
+    (void)result;
+}
@@ -27,7 +27,7 @@ int main () {
             auto transformed = fusion::as_vector(fusion::transform(values, [&](auto t) {
                 return result += t;
             }));
-            (void)transformed;
+            hana::benchmark::do_not_optimize(transformed);
         }
     });
 }
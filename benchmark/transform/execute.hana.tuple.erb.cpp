@@ -20,7 +20,7 @@ int main () {
             auto transformed = boost::hana::transform(values, [&](auto t) {
                 return result += t;
             });
-            (void)transformed;
+            boost::hana::benchmark::do_not_optimize(transformed);
         }
     });
 }
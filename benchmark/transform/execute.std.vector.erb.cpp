@@ -23,5 +23,6 @@ int main () {
                 return result += t;
             });
         }
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/tree_fold.hpp>
+#include <boost/hana/ext/std/array.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+
+
+int main () {
+    std::array<double, <%= input_size %>> values;
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = std::rand() % 1000;
+
+    boost::hana::benchmark::measure([&] {
+        double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::benchmark::do_not_optimize(values);
+            result += boost::hana::experimental::tree_sum(values);
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
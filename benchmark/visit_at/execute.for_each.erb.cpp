@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <vector>
+
+
+template <int i>
+struct x { long long value; };
+
+int main () {
+    auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{#{n}}" }.join(', ') %>
+    );
+    // Visit the elements in an order the branch predictor can't guess.
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i != 1 << 10; ++i)
+        indices.push_back(i * 7919 % <%= input_size %>);
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (std::size_t index : indices) {
+            auto size = boost::hana::length(tuple);
+            boost::hana::for_each(boost::hana::make_range(boost::hana::size_c<0>, size), [&](auto i) {
+                if (i == index)
+                    result += boost::hana::at(tuple, i).value;
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
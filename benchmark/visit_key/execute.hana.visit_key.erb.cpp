@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/experimental/visit_key.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <vector>
+
+
+int main () {
+    auto map = boost::hana::make_map(
+        <%= (1..input_size).map { |n|
+            "boost::hana::make_pair(#{hana_string("member_#{n}")}, #{n})"
+        }.join(",\n        ") %>
+    );
+    // Look up each key in turn, along with as many unknown keys.
+    std::vector<std::string> queries;
+    for (int i = 1; i <= <%= input_size %>; ++i) {
+        queries.push_back("member_" + std::to_string(i));
+        queries.push_back("unknown_" + std::to_string(i));
+    }
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (std::string const& query : queries) {
+            boost::hana::experimental::visit_key(boost::hana::keys(map), query, [&](auto key) {
+                result += map[key];
+            });
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+int main () {
+    std::unordered_map<std::string, int> map{
+        <%= (1..input_size).map { |n| "{\"member_#{n}\", #{n}}" }.join(",\n        ") %>
+    };
+    // Look up each key in turn, along with as many unknown keys.
+    std::vector<std::string> queries;
+    for (int i = 1; i <= <%= input_size %>; ++i) {
+        queries.push_back("member_" + std::to_string(i));
+        queries.push_back("unknown_" + std::to_string(i));
+    }
+
+    boost::hana::benchmark::measure([&] {
+        long long result = 0;
+        for (std::string const& query : queries) {
+            auto it = map.find(query);
+            if (it != map.end())
+                result += it->second;
+        }
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
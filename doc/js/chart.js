@@ -14,11 +14,24 @@
       };
     }
 
+    // Series measuring the peak memory of the compiler are plotted against
+    // a second axis, on the right of the chart.
+    var hasMemorySeries = options.series.some(function(series) {
+      return series.yAxis == 1;
+    });
+
     if (options.yAxis == undefined) {
       options.yAxis = {
         title: { text: "Time (s)" },
         floor: 0
       };
+      if (hasMemorySeries) {
+        options.yAxis = [options.yAxis, {
+          title: { text: "Peak memory (MB)" },
+          floor: 0,
+          opposite: true
+        }];
+      }
     }
 
     if (options.subtitle == undefined) {
@@ -56,8 +69,20 @@
       , 'fusion::list': '#91e8e1'
     };
     options.series.forEach(function(series) {
-      if (colorMap[series.name])
-        series.color = colorMap[series.name];
+      // Series named `xxx (memory)`, `xxx (min)` or `xxx (p95)` are drawn
+      // with the color of the `xxx` series. Those with statistics about the
+      // execution time are dotted.
+      var name = series.name.replace(/ \((memory|min|p95)\)$/, '');
+      if (colorMap[name])
+        series.color = colorMap[name];
+
+      if (/ \((min|p95)\)$/.test(series.name))
+        series.dashStyle = series.dashStyle || 'Dot';
+
+      if (series.yAxis == 1) {
+        series.dashStyle = series.dashStyle || 'ShortDash';
+        series.tooltip = series.tooltip || { valueSuffix: 'MB' };
+      }
     });
 
     options.tooltip = options.tooltip || {};
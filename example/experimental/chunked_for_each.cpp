@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/chunked_for_each.hpp>
+#include <boost/hana/range.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::vector<int> squares;
+
+    // The body of the lambda appears at most 5 times in the executable,
+    // instead of 1000 times with `hana::for_each`.
+    hana::experimental::chunked_for_each<4>(hana::range_c<int, 0, 1000>, [&](int i) {
+        squares.push_back(i * i);
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(squares.size() == 1000);
+    BOOST_HANA_RUNTIME_CHECK(squares[12] == 144);
+}
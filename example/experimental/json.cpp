@@ -0,0 +1,49 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (std::vector<Car>, cars)
+    );
+};
+
+int main() {
+    Person john{"John", 30, {{"BMW", "Z3"}, {"Audi", "A4"}}};
+
+    std::string json;
+    hana::experimental::to_json(json, john);
+    BOOST_HANA_RUNTIME_CHECK(json ==
+        R"({"name":"John","age":30,"cars":[{"brand":"BMW","model":"Z3"},{"brand":"Audi","model":"A4"}]})"
+    );
+
+    // Keys may appear in any order, and unknown keys are ignored.
+    Person jane;
+    hana::experimental::from_json(R"({
+        "age": 25,
+        "name": "Jane",
+        "email": "jane@example.com",
+        "cars": [{"model": "Model 3", "brand": "Tesla"}]
+    })", jane);
+    BOOST_HANA_RUNTIME_CHECK(jane.name == "Jane");
+    BOOST_HANA_RUNTIME_CHECK(jane.age == 25);
+    BOOST_HANA_RUNTIME_CHECK(jane.cars[0].brand == "Tesla");
+}
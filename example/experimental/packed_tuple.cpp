@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/packed_tuple.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // The double is stored first, so there is no padding between the chars.
+    hana::experimental::packed_tuple<char, double, char, int> xs{'a', 1.5, 'b', 3};
+    static_assert(sizeof(xs) < sizeof(hana::tuple<char, double, char, int>), "");
+
+    // However, the elements are accessed in the order in which they are given.
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 'a');
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 1.5);
+
+    double sum = hana::fold_left(xs, 0.0, [](double s, auto x) { return s + x; });
+    BOOST_HANA_RUNTIME_CHECK(sum == 'a' + 1.5 + 'b' + 3);
+}
@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (float, x),
+        (float, y)
+    );
+};
+
+struct Polygon {
+    BOOST_HANA_DEFINE_STRUCT(Polygon,
+        (std::string, name),
+        (std::vector<Point>, points)
+    );
+};
+
+int main() {
+    Polygon triangle{"triangle", {{0, 0}, {1, 0}, {0, 1}}};
+
+    // The points are written with a single copy, since they are made of
+    // floats stored contiguously.
+    std::string bytes = hana::experimental::serialize(triangle);
+
+    Polygon copy;
+    hana::experimental::buffer_reader reader{bytes};
+    hana::experimental::deserialize(reader, copy);
+    BOOST_HANA_RUNTIME_CHECK(copy.name == "triangle");
+    BOOST_HANA_RUNTIME_CHECK(copy.points.size() == 3);
+    BOOST_HANA_RUNTIME_CHECK(copy.points[2].y == 1);
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <numeric>
+namespace hana = boost::hana;
+
+
+struct Particle {
+    BOOST_HANA_DEFINE_STRUCT(Particle,
+        (float, x),
+        (float, y),
+        (int, id)
+    );
+};
+
+int main() {
+    hana::experimental::soa_vector<Particle> particles;
+    particles.push_back(Particle{1.f, 2.f, 0});
+    particles.emplace_back(3.f, 4.f, 1);
+    particles.emplace_back(5.f, 6.f, 2);
+
+    // Each member is stored contiguously, so it can be scanned on its own.
+    auto xs = particles.span(BOOST_HANA_STRING("x"));
+    BOOST_HANA_RUNTIME_CHECK(std::accumulate(xs.begin(), xs.end(), 0.f) == 9.f);
+
+    // Elements are accessed through proxies that behave like a `Particle`.
+    auto p = particles[1];
+    p[BOOST_HANA_STRING("y")] = 40.f;
+    BOOST_HANA_RUNTIME_CHECK(particles.span(BOOST_HANA_STRING("y"))[1] == 40.f);
+
+    Particle copy = particles.back();
+    BOOST_HANA_RUNTIME_CHECK(copy.id == 2);
+}
@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/tree_fold.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Any associative function can be used; it is called as
+    // f(f("a", "b"), f("c", "d")), which has the same result as a left fold.
+    auto words = hana::make_tuple(std::string{"a"}, std::string{"b"},
+                                  std::string{"c"}, std::string{"d"});
+    auto sentence = hana::experimental::tree_fold(words, [](std::string x, std::string const& y) {
+        return x += y;
+    });
+    BOOST_HANA_RUNTIME_CHECK(sentence == "abcd");
+
+    // The usual reductions are provided, and large arrays are reduced with
+    // several independent accumulators.
+    std::array<double, 64> samples{};
+    samples[3] = 2.5;
+    samples[42] = -1.5;
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_sum(samples) == 1.0);
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_maximum(samples) == 2.5);
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_minimum(samples) == -1.5);
+}
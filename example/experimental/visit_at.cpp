@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/visit_at.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Circle { double radius; };
+struct Square { double side; };
+
+double area(Circle c) { return 3 * c.radius * c.radius; }
+double area(Square s) { return s.side * s.side; }
+
+int main() {
+    auto shapes = hana::make_tuple(Circle{1}, Square{2});
+
+    // The index is only known at runtime, e.g. read from a message tag.
+    std::size_t tag = 1;
+
+    double result = 0;
+    bool valid = hana::experimental::visit_at(shapes, tag, [&](auto const& shape) {
+        result = area(shape);
+    });
+    BOOST_HANA_RUNTIME_CHECK(valid);
+    BOOST_HANA_RUNTIME_CHECK(result == 4);
+
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(shapes, 2, [](auto const&) { }));
+}
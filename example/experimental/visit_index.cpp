@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/visit_index.hpp>
+#include <boost/hana/range.hpp>
+
+#include <array>
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+// A buffer whose size is a template parameter.
+template <std::size_t N>
+std::size_t process() {
+    std::array<char, N> buffer{};
+    return buffer.size();
+}
+
+int main() {
+    // The size is only known at runtime, e.g. read from a configuration file.
+    int size = 3;
+
+    std::size_t processed = 0;
+    bool valid = hana::experimental::visit_index(hana::range_c<std::size_t, 1, 9>, size, [&](auto n) {
+        processed = process<decltype(n)::value>();
+    });
+    BOOST_HANA_RUNTIME_CHECK(valid);
+    BOOST_HANA_RUNTIME_CHECK(processed == 3);
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/visit_key.hpp>
+#include <boost/hana/keys.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Config {
+    BOOST_HANA_DEFINE_STRUCT(Config,
+        (int, width),
+        (int, height),
+        (int, depth)
+    );
+};
+
+// Sets the member of `config` whose name is only known at runtime.
+bool set(Config& config, std::string const& name, int value) {
+    return hana::experimental::visit_key(hana::keys(config), name, [&](auto key) {
+        hana::at_key(config, key) = value;
+    });
+}
+
+int main() {
+    Config config{0, 0, 0};
+    BOOST_HANA_RUNTIME_CHECK(set(config, "height", 768));
+    BOOST_HANA_RUNTIME_CHECK(!set(config, "length", 10));
+    BOOST_HANA_RUNTIME_CHECK(config.height == 768);
+}
@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/forward_members.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+int main() {
+    Person john{"John", 30};
+
+    static_assert(std::is_same<
+        decltype(hana::forward_members(john)),
+        hana::tuple<std::string&, unsigned short&>
+    >{}, "");
+
+    hana::for_each(hana::forward_members(john), [](auto& member) {
+        member += member;
+    });
+    BOOST_HANA_RUNTIME_CHECK(john.name == "JohnJohn");
+    BOOST_HANA_RUNTIME_CHECK(john.age == 60);
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/sort_by_key.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+// Sort types by alignment, e.g. to lay out the members of a struct with
+// as little padding as possible.
+auto types = hana::tuple_t<char[3], double, short, char, int>;
+
+auto sorted = hana::sort_by_key(types, hana::alignof_);
+
+BOOST_HANA_CONSTANT_CHECK(
+    hana::first(sorted) == hana::tuple_t<char[3], char, short, int, double>
+);
+
+// The permutation maps each position in the sorted sequence to the index
+// of the element in the original sequence.
+BOOST_HANA_CONSTANT_CHECK(
+    hana::second(sorted) == hana::make_tuple(
+        hana::size_c<0>, hana::size_c<3>, hana::size_c<2>, hana::size_c<4>, hana::size_c<1>
+    )
+);
+
+int main() { }
@@ -108,6 +108,7 @@ namespace boost {
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fold_right.hpp>
 #include <boost/hana/for_each.hpp>
+#include <boost/hana/forward_members.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional.hpp>
 #include <boost/hana/fuse.hpp>
@@ -178,6 +179,7 @@ namespace boost {
 #include <boost/hana/size.hpp>
 #include <boost/hana/slice.hpp>
 #include <boost/hana/sort.hpp>
+#include <boost/hana/sort_by_key.hpp>
 #include <boost/hana/span.hpp>
 #include <boost/hana/string.hpp>
 #include <boost/hana/suffix.hpp>
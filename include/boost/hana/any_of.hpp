@@ -15,11 +15,14 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
@@ -27,8 +30,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/if.hpp>
 #include <boost/hana/is_empty.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -55,6 +60,36 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Args&& ...) = delete;
     };
 
+    namespace detail {
+        // When the predicate returns an `IntegralConstant` for every element
+        // of a sequence, the result of `any_of` is computed from the types
+        // of these results in a single pack expansion, instead of walking
+        // the sequence with one helper instantiation per element.
+        template <typename ...R>
+        struct any_of_results {
+            static constexpr bool is_constant = detail::fast_and<
+                hana::IntegralConstant<R>::value...
+            >::value;
+
+            // Only instantiated when all the results are `IntegralConstant`s.
+            struct result {
+                static constexpr bool value = !detail::fast_and<
+                    !static_cast<bool>(R::value)...
+                >::value;
+            };
+        };
+
+        template <typename Pred>
+        struct make_any_of_results {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...) const -> any_of_results<
+                typename detail::decay<
+                    decltype(std::declval<Pred&>()(std::declval<X>()))
+                >::type...
+            > { return {}; }
+        };
+    }
+
     template <typename S>
     struct any_of_impl<S, when<Sequence<S>::value>> {
         //! @cond
@@ -91,13 +126,28 @@ BOOST_HANA_NAMESPACE_BEGIN
             { return cond; }
         };
 
-        template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr auto apply_impl(hana::true_, Xs&&, Pred&&)
+        { return hana::bool_c<Results::result::value>; }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr auto apply_impl(hana::false_, Xs&& xs, Pred&& pred) {
             constexpr std::size_t len = decltype(hana::length(xs))::value;
             return any_of_impl::any_of_helper<0, len>::apply(hana::false_c,
                                             static_cast<Xs&&>(xs),
                                             static_cast<Pred&&>(pred));
         }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using Results = decltype(hana::unpack(
+                std::declval<Xs&>(), detail::make_any_of_results<Pred>{}
+            ));
+            return any_of_impl::apply_impl<Results>(
+                hana::bool_c<Results::is_constant>,
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
         //! @endcond
     };
 
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
@@ -85,12 +86,27 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename S>
     struct at_key_impl<S, when<hana::Struct<S>::value>> {
         template <typename X, typename Key>
-        static constexpr decltype(auto) apply(X&& x, Key const& key) {
+        static constexpr decltype(auto) apply_impl(X&& x, Key const&, hana::true_) {
+            using MaybeIndex = typename struct_detail::find_member_index<S, Key>::type;
+            auto accessor = hana::second(
+                hana::at(hana::accessors<S>(), MaybeIndex{}.value())
+            );
+            return accessor(static_cast<X&&>(x));
+        }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply_impl(X&& x, Key const& key, hana::false_) {
             auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
                 hana::equal.to(key) ^hana::on^ hana::first
             ));
             return accessor(static_cast<X&&>(x));
         }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply(X&& x, Key const& key) {
+            return apply_impl(static_cast<X&&>(x), key,
+                hana::bool_c<struct_detail::has_member_table<S, Key>::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
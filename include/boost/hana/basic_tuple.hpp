@@ -15,6 +15,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/ebo.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/bool.hpp>
 #include <boost/hana/fwd/concept/sequence.hpp>
@@ -70,6 +72,85 @@ BOOST_HANA_NAMESPACE_BEGIN
                 : detail::ebo<bti<n>, Xn>(static_cast<Yn&&>(yn))...
             { }
         };
+
+        //////////////////////////////////////////////////////////////////////
+        // basic_tuple_array<n, T>
+        //
+        // Storage used when all the elements have the same type. A plain
+        // array is much cheaper to instantiate than one `ebo` base per
+        // element, and the compiler can treat the elements as contiguous.
+        // This is only used when it can't be noticed: `T` must not be empty,
+        // since it would lose the EBO, and it must be trivially copyable,
+        // since the elements are copied from temporaries.
+        //////////////////////////////////////////////////////////////////////
+        template <typename Indices, typename T>
+        struct basic_tuple_array;
+
+        template <std::size_t ...n, typename T>
+        struct basic_tuple_array<std::index_sequence<n...>, T> {
+            static constexpr std::size_t size_ = sizeof...(n);
+            T data_[sizeof...(n)];
+
+            constexpr basic_tuple_array() : data_() { }
+
+            template <typename Other>
+            explicit constexpr basic_tuple_array(detail::from_other, Other&& other)
+                : data_{static_cast<Other&&>(other).data_[n]...}
+            { }
+
+            template <typename ...Yn>
+            explicit constexpr basic_tuple_array(Yn&& ...yn)
+                : data_{static_cast<T>(static_cast<Yn&&>(yn))...}
+            { }
+        };
+
+        // `ebo_get<bti<n>>` is used to access the elements of a `basic_tuple`
+        // whatever its storage, so it is also provided for the array storage.
+        template <typename K>
+        struct bti_value;
+
+        template <std::size_t n>
+        struct bti_value<bti<n>> {
+            static constexpr std::size_t value = n;
+        };
+
+        template <typename K, typename Indices, typename T>
+        constexpr T const& ebo_get(basic_tuple_array<Indices, T> const& xs)
+        { return xs.data_[bti_value<K>::value]; }
+
+        template <typename K, typename Indices, typename T>
+        constexpr T& ebo_get(basic_tuple_array<Indices, T>& xs)
+        { return xs.data_[bti_value<K>::value]; }
+
+        template <typename K, typename Indices, typename T>
+        constexpr T&& ebo_get(basic_tuple_array<Indices, T>&& xs)
+        { return static_cast<T&&>(xs.data_[bti_value<K>::value]); }
+
+        //////////////////////////////////////////////////////////////////////
+        // basic_tuple_storage<Xn...>
+        //////////////////////////////////////////////////////////////////////
+        template <typename ...Xn>
+        struct basic_tuple_types;
+
+        template <typename ...Xn>
+        struct basic_tuple_storage {
+            using type = basic_tuple_impl<std::make_index_sequence<sizeof...(Xn)>, Xn...>;
+        };
+
+        // A pack is homogeneous if and only if rotating it yields the same
+        // pack, which is much cheaper to check than comparing each element.
+        template <typename X, typename ...Xn>
+        struct basic_tuple_storage<X, Xn...>
+            : std::conditional<
+                sizeof...(Xn) != 0 &&
+                std::is_same<basic_tuple_types<X, Xn...>,
+                             basic_tuple_types<Xn..., X>>::value &&
+                std::is_trivially_copyable<X>::value &&
+                !BOOST_HANA_TT_IS_EMPTY(X),
+                basic_tuple_array<std::make_index_sequence<sizeof...(Xn) + 1>, X>,
+                basic_tuple_impl<std::make_index_sequence<sizeof...(Xn) + 1>, X, Xn...>
+            >
+        { };
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -78,9 +159,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
     template <typename ...Xn>
     struct basic_tuple final
-        : detail::basic_tuple_impl<std::make_index_sequence<sizeof...(Xn)>, Xn...>
+        : detail::basic_tuple_storage<Xn...>::type
     {
-        using Base = detail::basic_tuple_impl<std::make_index_sequence<sizeof...(Xn)>, Xn...>;
+        using Base = typename detail::basic_tuple_storage<Xn...>::type;
 
         constexpr basic_tuple() = default;
 
@@ -104,6 +185,32 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = basic_tuple_tag;
     };
 
+    namespace detail {
+        template <typename Storage>
+        struct basic_tuple_homogeneous_storage {
+            static constexpr bool value = false;
+        };
+
+        template <typename Indices, typename T>
+        struct basic_tuple_homogeneous_storage<basic_tuple_array<Indices, T>> {
+            static constexpr bool value = true;
+            static constexpr std::size_t size = Indices::size();
+
+            static constexpr T* data(basic_tuple_array<Indices, T>& xs)
+            { return xs.data_; }
+
+            static constexpr T const* data(basic_tuple_array<Indices, T> const& xs)
+            { return xs.data_; }
+        };
+
+        template <typename ...Xn>
+        struct homogeneous_storage<basic_tuple<Xn...>>
+            : basic_tuple_homogeneous_storage<
+                typename basic_tuple_storage<Xn...>::type
+            >
+        { };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
@@ -138,6 +245,24 @@ BOOST_HANA_NAMESPACE_BEGIN
                 )...
             );
         }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr decltype(auto)
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T> const& xs, F&& f) {
+            return static_cast<F&&>(f)(xs.data_[i]...);
+        }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr decltype(auto)
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T>& xs, F&& f) {
+            return static_cast<F&&>(f)(xs.data_[i]...);
+        }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr decltype(auto)
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T>&& xs, F&& f) {
+            return static_cast<F&&>(f)(static_cast<T&&>(xs.data_[i])...);
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -174,6 +299,24 @@ BOOST_HANA_NAMESPACE_BEGIN
                 ))...
             );
         }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr auto
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T> const& xs, F const& f) {
+            return hana::make_basic_tuple(f(xs.data_[i])...);
+        }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr auto
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T>& xs, F const& f) {
+            return hana::make_basic_tuple(f(xs.data_[i])...);
+        }
+
+        template <std::size_t ...i, typename T, typename F>
+        static constexpr auto
+        apply(detail::basic_tuple_array<std::index_sequence<i...>, T>&& xs, F const& f) {
+            return hana::make_basic_tuple(f(static_cast<T&&>(xs.data_[i]))...);
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -104,6 +104,12 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONSTEXPR_LAMBDA /* nothing */
 #endif
 
+// `BOOST_HANA_CONFIG_HAS_EXCEPTIONS` is defined unless exceptions are
+// disabled (e.g. with `-fno-exceptions`).
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#   define BOOST_HANA_CONFIG_HAS_EXCEPTIONS
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // Namespace macros
 //////////////////////////////////////////////////////////////////////////////
@@ -170,4 +176,35 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONFIG_ENABLE_DEBUG_MODE
 #endif
 
+#if defined(BOOST_HANA_DOXYGEN_INVOKED)
+    //! @ingroup group-config
+    //! Enables the use of vector instructions by some experimental reductions.
+    //!
+    //! When this macro is defined (it is __not defined__ by default) and the
+    //! compiler supports the GNU vector extensions, `experimental::tree_sum`
+    //! and friends reduce large arrays of arithmetic values with SIMD
+    //! registers. Like any reassociation, this may change the result of
+    //! floating-point reductions, and these reductions are then no longer
+    //! usable in constant expressions.
+#   define BOOST_HANA_CONFIG_ENABLE_SIMD
+#endif
+
+#if defined(BOOST_HANA_DOXYGEN_INVOKED) || \
+    !defined(BOOST_HANA_CONFIG_LOOP_THRESHOLD)
+    //! @ingroup group-config
+    //! Minimum number of elements above which some algorithms use a runtime
+    //! loop instead of being unrolled.
+    //!
+    //! When all the elements of a sequence have the same type and are stored
+    //! contiguously (e.g. `std::array` or a `hana::tuple<double, ...>`), and
+    //! the function does not change the type of the result from one element
+    //! to the next, `fold_left`, `fold_right`, `for_each` and `transform` are
+    //! implemented with an ordinary loop once the sequence has at least this
+    //! many elements. This avoids generating huge functions for large
+    //! sequences, and lets the optimizer vectorize the loop. It defaults to
+    //! 32, and it can be defined by users before including any Hana header
+    //! or on the command line.
+#   define BOOST_HANA_CONFIG_LOOP_THRESHOLD 32
+#endif
+
 #endif // !BOOST_HANA_CONFIG_HPP
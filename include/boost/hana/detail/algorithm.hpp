@@ -123,6 +123,49 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     { detail::sort(first, last, hana::_ < hana::_); }
 
 
+    template <typename InputIter1, typename InputIter2,
+              typename OutputIter, typename BinaryPred>
+    constexpr OutputIter merge_ranges(InputIter1 first1, InputIter1 last1,
+                                      InputIter2 first2, InputIter2 last2,
+                                      OutputIter out, BinaryPred pred)
+    {
+        while (first1 != last1 && first2 != last2) {
+            if (pred(*first2, *first1))
+                *out++ = *first2++;
+            else
+                *out++ = *first1++;
+        }
+        while (first1 != last1)
+            *out++ = *first1++;
+        while (first2 != last2)
+            *out++ = *first2++;
+        return out;
+    }
+
+    // Bottom-up merge sort of [first, last), using [buffer, buffer + (last -
+    // first)) as scratch space. The sorted range is left in [first, last).
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void stable_sort(RandomIter first, RandomIter last,
+                               RandomIter buffer, BinaryPred pred)
+    {
+        std::size_t const n = static_cast<std::size_t>(last - first);
+        RandomIter from = first;
+        RandomIter to = buffer;
+        for (std::size_t width = 1; width < n; width *= 2) {
+            for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+                std::size_t mid = lo + width < n ? lo + width : n;
+                std::size_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+                detail::merge_ranges(from + lo, from + mid, from + mid, from + hi,
+                                     to + lo, pred);
+            }
+            detail::constexpr_swap(from, to);
+        }
+        if (from != first)
+            for (std::size_t i = 0; i < n; ++i)
+                first[i] = from[i];
+    }
+
+
     template <typename InputIter, typename T>
     constexpr InputIter find(InputIter first, InputIter last, T const& value) {
         for (; first != last; ++first)
@@ -83,6 +83,17 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         constexpr auto sort() const
         { return this->sort(hana::_ < hana::_); }
 
+        template <typename BinaryPred>
+        constexpr auto stable_sort(BinaryPred pred) const {
+            array result = *this;
+            array buffer = *this;
+            detail::stable_sort(result.begin(), result.end(), buffer.begin(), pred);
+            return result;
+        }
+
+        constexpr auto stable_sort() const
+        { return this->stable_sort(hana::_ < hana::_); }
+
         template <typename U>
         constexpr auto iota(U value) const {
             array result = *this;
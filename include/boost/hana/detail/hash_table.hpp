@@ -11,6 +11,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
@@ -52,6 +54,66 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     };
     // end find_indices
 
+    // direct_table:
+    //  A table for keys whose hashes are `integral_constant`s of the same
+    //  type `T` spanning a small range of values. The index associated to
+    //  the key with hash `Min + n` is `Slots[n]`, or `no_slot` if there is
+    //  no such key. Looking a key up is then a matter of subtracting `Min`
+    //  from its hash, instead of doing overload resolution on one base
+    //  class per key like for `hash_table`.
+    constexpr std::size_t no_slot = static_cast<std::size_t>(-1);
+
+    template <typename T, T Min, std::size_t ...Slots>
+    struct direct_table {
+        static constexpr std::size_t size = sizeof...(Slots);
+        static constexpr std::size_t slots[size + 1] = {Slots..., no_slot};
+
+        static constexpr std::size_t occupied_count() {
+            std::size_t count = 0;
+            for (std::size_t k = 0; k < size; ++k)
+                count += slots[k] != no_slot;
+            return count;
+        }
+
+        // The offset of the slot for the given hash, or `no_slot` if the
+        // hash falls outside of the table.
+        template <typename Hash>
+        static constexpr std::size_t offset(Hash const*)
+        { return no_slot; }
+
+        template <T x>
+        static constexpr std::size_t offset(hana::integral_constant<T, x> const*) {
+            using U = unsigned long long;
+            return x < Min || static_cast<U>(x) - static_cast<U>(Min) >= size
+                ? no_slot
+                : static_cast<std::size_t>(static_cast<U>(x) - static_cast<U>(Min));
+        }
+
+        template <typename Hash>
+        static constexpr std::size_t slot() {
+            constexpr std::size_t n = offset(static_cast<Hash const*>(nullptr));
+            return n == no_slot ? no_slot : slots[n];
+        }
+    };
+
+    template <typename T, T Min, std::size_t ...Slots>
+    constexpr std::size_t direct_table<T, Min, Slots...>::slots[];
+
+    template <std::size_t Slot>
+    struct direct_indices { using type = std::index_sequence<Slot>; };
+
+    template <>
+    struct direct_indices<no_slot> { using type = std::index_sequence<>; };
+
+    template <typename T, T Min, std::size_t ...Slots, typename Key>
+    struct find_indices<direct_table<T, Min, Slots...>, Key> {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = typename direct_indices<
+            direct_table<T, Min, Slots...>::template slot<Hash>()
+        >::type;
+    };
+    // end direct_table
+
     // find_index:
     //  Returns the actual index of a `Key` in the `Map`. The type of the key
     //  associated to any given index must be retrievable with the `KeyAtIndex`
@@ -123,8 +185,185 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<Buckets..., bucket<Hash, Index>>;
     };
+
+    // Inserting in a `direct_table` keeps it as-is if the new key falls in
+    // an empty slot of the table, and turns it into a `hash_table` otherwise.
+    template <typename Table, typename Indices>
+    struct direct_to_hash_table;
+
+    template <typename T, T Min, std::size_t ...Slots, std::size_t ...n>
+    struct direct_to_hash_table<direct_table<T, Min, Slots...>, std::index_sequence<n...>> {
+        static constexpr std::size_t N = sizeof...(Slots);
+        static constexpr std::size_t slots[N + 1] = {Slots..., no_slot};
+
+        static constexpr auto compute_occupied() {
+            detail::array<std::size_t, N> occupied{};
+            for (std::size_t k = 0, i = 0; k < N; ++k)
+                if (slots[k] != no_slot)
+                    occupied[i++] = k;
+            return occupied;
+        }
+
+        static constexpr detail::array<std::size_t, N> occupied = compute_occupied();
+
+        using type = hash_table<
+            bucket<hana::integral_constant<T, static_cast<T>(Min + occupied[n])>,
+                   slots[occupied[n]]>...
+        >;
+    };
+
+    template <typename T, T Min, std::size_t ...Slots, std::size_t ...n>
+    constexpr std::size_t direct_to_hash_table<
+        direct_table<T, Min, Slots...>, std::index_sequence<n...>
+    >::slots[];
+
+    template <typename T, T Min, std::size_t ...Slots, std::size_t ...n>
+    constexpr detail::array<std::size_t, direct_to_hash_table<
+        direct_table<T, Min, Slots...>, std::index_sequence<n...>
+    >::N> direct_to_hash_table<
+        direct_table<T, Min, Slots...>, std::index_sequence<n...>
+    >::occupied;
+
+    template <typename Table, typename Key, std::size_t Index, std::size_t Offset,
+              bool = Offset != no_slot,
+              typename Indices = std::make_index_sequence<Table::size>>
+    struct direct_table_insert {
+        using HashTable = typename direct_to_hash_table<
+            Table, std::make_index_sequence<Table::occupied_count()>
+        >::type;
+        using type = typename bucket_insert<HashTable, Key, Index>::type;
+    };
+
+    template <typename T, T Min, std::size_t ...Slots, typename Key, std::size_t Index,
+              std::size_t Offset, std::size_t ...k>
+    struct direct_table_insert<direct_table<T, Min, Slots...>, Key, Index, Offset,
+                               true, std::index_sequence<k...>>
+    {
+        using type = direct_table<T, Min, (k == Offset ? Index : Slots)...>;
+    };
+
+    template <typename T, T Min, std::size_t ...Slots, typename Key, std::size_t Index>
+    struct bucket_insert<direct_table<T, Min, Slots...>, Key, Index, false> {
+        using Table = direct_table<T, Min, Slots...>;
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = typename direct_table_insert<
+            Table, Key, Index, Table::offset(static_cast<Hash const*>(nullptr))
+        >::type;
+    };
+
+    template <typename T, T Min, std::size_t ...Slots, typename Key, std::size_t Index>
+    struct bucket_insert<direct_table<T, Min, Slots...>, Key, Index, true> {
+        // The slot is already taken by a different key with the same hash.
+        using type = typename direct_table_insert<
+            direct_table<T, Min, Slots...>, Key, Index, no_slot
+        >::type;
+    };
     // end bucket_insert
 
+    // make_direct_table:
+    //  Turns a `hash_table` with one key per bucket into a `direct_table`
+    //  when all the hashes are `integral_constant`s of the same (integer)
+    //  type, and their values are dense enough for the table to take no
+    //  more than twice the number of keys. Otherwise, the `hash_table` is
+    //  returned unchanged.
+    template <typename T>
+    struct is_direct_table_index : std::false_type { };
+
+    template <>
+    struct is_direct_table_index<signed long long> : std::true_type { };
+
+    template <>
+    struct is_direct_table_index<unsigned long long> : std::true_type { };
+
+    template <typename HashTable, typename = void>
+    struct make_direct_table {
+        using type = HashTable;
+    };
+
+    template <typename Values, typename Indices>
+    struct direct_table_layout;
+
+    template <typename T, T ...x, std::size_t ...i>
+    struct direct_table_layout<std::integer_sequence<T, x...>, std::index_sequence<i...>> {
+        static constexpr T values[sizeof...(x)] = {x...};
+        static constexpr std::size_t indices[sizeof...(i)] = {i...};
+
+        static constexpr T min() {
+            T m = values[0];
+            for (std::size_t k = 1; k < sizeof...(x); ++k)
+                m = values[k] < m ? values[k] : m;
+            return m;
+        }
+
+        static constexpr T max() {
+            T m = values[0];
+            for (std::size_t k = 1; k < sizeof...(x); ++k)
+                m = m < values[k] ? values[k] : m;
+            return m;
+        }
+
+        static constexpr T Min = min();
+        static constexpr unsigned long long span =
+            static_cast<unsigned long long>(max()) - static_cast<unsigned long long>(Min);
+        static constexpr bool dense = span < 2 * sizeof...(x);
+        static constexpr std::size_t size = dense ? static_cast<std::size_t>(span) + 1 : 0;
+
+        static constexpr auto compute_slots() {
+            detail::array<std::size_t, size> slots{};
+            for (std::size_t k = 0; k < size; ++k)
+                slots[k] = no_slot;
+            for (std::size_t k = 0; dense && k < sizeof...(x); ++k)
+                slots[static_cast<unsigned long long>(values[k]) -
+                      static_cast<unsigned long long>(Min)] = indices[k];
+            return slots;
+        }
+
+        static constexpr detail::array<std::size_t, size> slots = compute_slots();
+    };
+
+    template <typename T, T ...x, std::size_t ...i>
+    constexpr T direct_table_layout<
+        std::integer_sequence<T, x...>, std::index_sequence<i...>
+    >::values[];
+
+    template <typename T, T ...x, std::size_t ...i>
+    constexpr std::size_t direct_table_layout<
+        std::integer_sequence<T, x...>, std::index_sequence<i...>
+    >::indices[];
+
+    template <typename T, T ...x, std::size_t ...i>
+    constexpr detail::array<std::size_t, direct_table_layout<
+        std::integer_sequence<T, x...>, std::index_sequence<i...>
+    >::size> direct_table_layout<
+        std::integer_sequence<T, x...>, std::index_sequence<i...>
+    >::slots;
+
+    template <typename HashTable, typename Layout, bool = Layout::dense,
+              typename Indices = std::make_index_sequence<Layout::size>>
+    struct make_direct_table_impl {
+        using type = HashTable;
+    };
+
+    template <typename HashTable, typename Layout, std::size_t ...n>
+    struct make_direct_table_impl<HashTable, Layout, true, std::index_sequence<n...>> {
+        using type = direct_table<
+            typename std::remove_cv<decltype(Layout::Min)>::type,
+            Layout::Min, Layout::slots[n]...
+        >;
+    };
+
+    template <typename T, T ...x, std::size_t ...i>
+    struct make_direct_table<
+        hash_table<bucket<hana::integral_constant<T, x>, i>...>,
+        typename std::enable_if<is_direct_table_index<T>::value>::type
+    >
+        : make_direct_table_impl<
+            hash_table<bucket<hana::integral_constant<T, x>, i>...>,
+            direct_table_layout<std::integer_sequence<T, x...>, std::index_sequence<i...>>
+        >
+    { };
+    // end make_direct_table
+
     // make_hash_table:
     //  Creates a `hash_table` type able of holding the given number of
     //  elements. The type of the key associated to any given index must
@@ -136,10 +375,221 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
 
     template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
     struct make_hash_table<KeyAtIndex, N, std::index_sequence<i...>> {
-        using type = hash_table<
+        using type = typename make_direct_table<hash_table<
             bucket<typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type, i>...
+        >>::type;
+    };
+    // end make_hash_table
+
+    // make_bulk_hash_table:
+    //  Creates a `hash_table` type for the given number of elements, like
+    //  `make_hash_table`, except that the keys may contain duplicates and
+    //  may have colliding hashes. Only the first occurence of each key is
+    //  kept; `indices` is an `index_sequence` containing the indices of the
+    //  kept elements (in order), and the indices stored in the buckets refer
+    //  to positions in that sequence.
+    //
+    //  This is done without rebuilding the `hash_table` for each element, as
+    //  successive `bucket_insert`s would. First, we put each key in its own
+    //  bucket; a key whose hash is shared by no other key is then found by
+    //  overload resolution, and it can neither have a duplicate nor collide.
+    //  Only the remaining keys are grouped by hash and compared with each
+    //  other, which does not happen at all in the common case.
+    template <typename Hash, std::size_t i>
+    std::true_type has_unique_hash(bucket<Hash, i> const&);
+
+    template <typename Hash>
+    std::false_type has_unique_hash(...);
+
+    // Provides an address that is unique to each `Hash`, which allows
+    // grouping the hashes inside `constexpr` functions.
+    template <typename Hash>
+    struct hash_id {
+        static constexpr char value = 0;
+    };
+
+    template <typename Hash>
+    constexpr char hash_id<Hash>::value;
+
+    template <template <std::size_t> class KeyAtIndex, typename Indices>
+    struct bulk_probe;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t ...i>
+    struct bulk_probe<KeyAtIndex, std::index_sequence<i...>> {
+        template <std::size_t k>
+        using Hash = typename decltype(hana::hash(std::declval<KeyAtIndex<k>>()))::type;
+
+        using type = hash_table<bucket<Hash<i>, i>...>;
+
+        static constexpr bool all_unique = detail::fast_and<
+            decltype(detail::has_unique_hash<Hash<i>>(std::declval<type>()))::value...
+        >::value;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename Indices>
+    struct bulk_groups;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t ...i>
+    struct bulk_groups<KeyAtIndex, std::index_sequence<i...>> {
+        using Probe = bulk_probe<KeyAtIndex, std::index_sequence<i...>>;
+        static constexpr std::size_t N = sizeof...(i);
+
+        static constexpr bool unique[N + 1] = {
+            decltype(detail::has_unique_hash<
+                typename Probe::template Hash<i>
+            >(std::declval<typename Probe::type>()))::value..., true
+        };
+
+        static constexpr char const* ids[N + 1] = {
+            &hash_id<typename Probe::template Hash<i>>::value..., nullptr
+        };
+
+        // The index of the first key with the same hash as each key.
+        static constexpr auto compute_leaders() {
+            detail::array<std::size_t, N> leader{};
+            for (std::size_t k = 0; k < N; ++k) {
+                leader[k] = k;
+                for (std::size_t j = 0; !unique[k] && j < k; ++j) {
+                    if (!unique[j] && ids[j] == ids[k]) {
+                        leader[k] = j;
+                        break;
+                    }
+                }
+            }
+            return leader;
+        }
+
+        static constexpr auto leader = compute_leaders();
+
+        // The number of keys before `k` with the same hash as `k`, and the
+        // index of the `n`th of them.
+        static constexpr std::size_t earlier_count(std::size_t k) {
+            std::size_t count = 0;
+            for (std::size_t j = leader[k]; j < k; ++j)
+                count += leader[j] == leader[k];
+            return count;
+        }
+
+        static constexpr std::size_t earlier(std::size_t k, std::size_t n) {
+            std::size_t j = leader[k];
+            for (; leader[j] != leader[k] || n-- != 0; ++j)
+                ;
+            return j;
+        }
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename Groups, std::size_t k,
+              typename Earlier = std::make_index_sequence<Groups::earlier_count(k)>>
+    struct bulk_is_first_occurence;
+
+    template <template <std::size_t> class KeyAtIndex, typename Groups,
+              std::size_t k, std::size_t ...n>
+    struct bulk_is_first_occurence<KeyAtIndex, Groups, k, std::index_sequence<n...>> {
+        static constexpr bool value = detail::fast_and<
+            !decltype(hana::equal(std::declval<KeyAtIndex<Groups::earlier(k, n)>>(),
+                                  std::declval<KeyAtIndex<k>>()))::value...
+        >::value;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename Indices>
+    struct bulk_layout;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t ...i>
+    struct bulk_layout<KeyAtIndex, std::index_sequence<i...>> {
+        using Groups = bulk_groups<KeyAtIndex, std::index_sequence<i...>>;
+        static constexpr std::size_t N = sizeof...(i);
+
+        static constexpr bool keep[N + 1] = {
+            bulk_is_first_occurence<KeyAtIndex, Groups, i>::value..., false
+        };
+
+        static constexpr std::size_t count(bool leaders_only) {
+            std::size_t count = 0;
+            for (std::size_t k = 0; k < N; ++k)
+                count += keep[k] && (!leaders_only || Groups::leader[k] == k);
+            return count;
+        }
+
+        static constexpr std::size_t kept_count = count(false);
+        static constexpr std::size_t bucket_count = count(true);
+
+        // The indices of the kept keys, and of the first key of each bucket.
+        static constexpr auto compute_kept(bool leaders_only) {
+            detail::array<std::size_t, (N > 0 ? N : 1)> kept{};
+            for (std::size_t k = 0, n = 0; k < N; ++k)
+                if (keep[k] && (!leaders_only || Groups::leader[k] == k))
+                    kept[n++] = k;
+            return kept;
+        }
+
+        static constexpr auto kept = compute_kept(false);
+        static constexpr auto bucket_leaders = compute_kept(true);
+
+        // The position of the `n`th kept key in the bucket whose first key
+        // is `g`, in the sequence of kept keys.
+        static constexpr std::size_t position(std::size_t g, std::size_t n) {
+            std::size_t pos = 0;
+            for (std::size_t k = 0; k < N; ++k) {
+                if (keep[k] && Groups::leader[k] == g && n-- == 0)
+                    return pos;
+                pos += keep[k];
+            }
+            return pos;
+        }
+
+        static constexpr std::size_t size(std::size_t g) {
+            std::size_t size = 0;
+            for (std::size_t k = g; k < N; ++k)
+                size += keep[k] && Groups::leader[k] == g;
+            return size;
+        }
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename Layout, std::size_t g,
+              typename Positions = std::make_index_sequence<Layout::size(g)>>
+    struct bulk_bucket;
+
+    template <template <std::size_t> class KeyAtIndex, typename Layout,
+              std::size_t g, std::size_t ...n>
+    struct bulk_bucket<KeyAtIndex, Layout, g, std::index_sequence<n...>> {
+        using type = bucket<
+            typename decltype(hana::hash(std::declval<KeyAtIndex<g>>()))::type,
+            Layout::position(g, n)...
         >;
     };
+
+    template <template <std::size_t> class KeyAtIndex, typename Layout,
+              typename Kept = std::make_index_sequence<Layout::kept_count>,
+              typename Buckets = std::make_index_sequence<Layout::bucket_count>>
+    struct make_bulk_hash_table_impl;
+
+    template <template <std::size_t> class KeyAtIndex, typename Layout,
+              std::size_t ...n, std::size_t ...b>
+    struct make_bulk_hash_table_impl<KeyAtIndex, Layout,
+                                     std::index_sequence<n...>,
+                                     std::index_sequence<b...>>
+    {
+        using type = hash_table<
+            typename bulk_bucket<KeyAtIndex, Layout, Layout::bucket_leaders[b]>::type...
+        >;
+        using indices = std::index_sequence<Layout::kept[n]...>;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Probe = bulk_probe<KeyAtIndex, std::make_index_sequence<N>>,
+              bool = Probe::all_unique>
+    struct make_bulk_hash_table {
+        using type = typename make_direct_table<typename Probe::type>::type;
+        using indices = std::make_index_sequence<N>;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N, typename Probe>
+    struct make_bulk_hash_table<KeyAtIndex, N, Probe, false>
+        : make_bulk_hash_table_impl<
+            KeyAtIndex, bulk_layout<KeyAtIndex, std::make_index_sequence<N>>
+        >
+    { };
+    // end make_bulk_hash_table
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_HASH_TABLE_HPP
@@ -0,0 +1,85 @@
+/*!
+@file
+Defines `boost::hana::detail::homogeneous_storage`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_HOMOGENEOUS_STORAGE_HPP
+#define BOOST_HANA_DETAIL_HOMOGENEOUS_STORAGE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Tells whether the elements of a container all have the same type and
+    //! are stored contiguously.
+    //!
+    //! Containers for which this is the case specialize `homogeneous_storage`
+    //! with a `true` `value`, the number of elements as `size`, and a static
+    //! `data` function returning a pointer to the first element for `const`
+    //! and non-`const` containers. Algorithms can then use a runtime loop
+    //! instead of expanding the function once per element.
+    template <typename Xs>
+    struct homogeneous_storage {
+        static constexpr bool value = false;
+    };
+
+    //! @ingroup group-details
+    //! Whether an algorithm on `Xs` should use a runtime loop.
+    //!
+    //! This is the case when `Xs` has a `homogeneous_storage` with at least
+    //! `BOOST_HANA_CONFIG_LOOP_THRESHOLD` elements, and at least 2 elements;
+    //! smaller containers are better served by unrolling. `Xs` may be a
+    //! reference type.
+    template <typename Xs, typename Storage = homogeneous_storage<
+        typename detail::decay<Xs>::type
+    >, bool = Storage::value>
+    struct use_loop {
+        static constexpr bool value = false;
+    };
+
+    template <typename Xs, typename Storage>
+    struct use_loop<Xs, Storage, true> {
+        static constexpr bool value =
+            Storage::size >= BOOST_HANA_CONFIG_LOOP_THRESHOLD &&
+            Storage::size >= 2;
+    };
+
+    //! @ingroup group-details
+    //! Indexed access to the elements of a container with a
+    //! `homogeneous_storage`, with the value category of the container.
+    //!
+    //! `Xs` is the type of the container as it is forwarded by algorithms,
+    //! i.e. an lvalue reference for lvalues and a non-reference for rvalues.
+    template <typename Xs>
+    struct homogeneous_elements {
+        using Storage = homogeneous_storage<typename detail::decay<Xs>::type>;
+        using pointer = decltype(Storage::data(std::declval<Xs&>()));
+        using reference = typename std::conditional<
+            std::is_lvalue_reference<Xs>::value,
+            typename std::remove_pointer<pointer>::type&,
+            typename std::remove_pointer<pointer>::type&&
+        >::type;
+        static constexpr std::size_t size = Storage::size;
+
+        pointer data;
+
+        explicit constexpr homogeneous_elements(Xs& xs)
+            : data(Storage::data(xs))
+        { }
+
+        constexpr reference operator[](std::size_t i) const
+        { return static_cast<reference>(data[i]); }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_HOMOGENEOUS_STORAGE_HPP
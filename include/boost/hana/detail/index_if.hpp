@@ -17,38 +17,49 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/optional.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail {
-    template <std::size_t i, std::size_t N, bool Done>
-    struct index_if_helper;
+    //! @ingroup group-details
+    //! Returns the index of the first `true` in `b...`, or `sizeof...(b)`
+    //! if there is none.
+    template <bool ...b>
+    struct first_true_index {
+        static constexpr std::size_t compute_index() {
+            constexpr bool bs[] = {b..., true}; // avoid empty array
+            std::size_t i = 0;
+            while (!bs[i])
+                ++i;
+            return i;
+        }
 
-    template <std::size_t i, std::size_t N>
-    struct index_if_helper<i, N, false> {
-        template <typename Pred, typename X1, typename ...Xs>
-        using f = typename index_if_helper<i + 1, N,
-            static_cast<bool>(detail::decay<decltype(
-                std::declval<Pred>()(std::declval<X1>()))>::type::value)
-        >::template f<Pred, Xs...>;
+        static constexpr std::size_t value = compute_index();
     };
 
-    template <std::size_t N>
-    struct index_if_helper<N, N, false> {
-        template <typename ...>
-        using f = hana::optional<>;
-    };
+    // The predicate is evaluated on all the elements in a single pack
+    // expansion, instead of recursing once per element. This keeps the
+    // instantiation depth constant, at the cost of not short-circuiting
+    // after the first element satisfying the predicate.
+    template <typename Pred, typename ...Xs>
+    struct index_if {
+        static constexpr std::size_t index = detail::first_true_index<
+            static_cast<bool>(detail::decay<decltype(
+                std::declval<Pred>()(std::declval<Xs>()))>::type::value)...
+        >::value;
 
-    template <std::size_t i, std::size_t N>
-    struct index_if_helper<i, N, true> {
-        template <typename ...>
-        using f = hana::optional<hana::size_t<i - 1>>;
+        using type = typename std::conditional<index == sizeof...(Xs),
+            hana::optional<>,
+            hana::optional<hana::size_t<index>>
+        >::type;
     };
 
-    template <typename Pred, typename ...Xs>
-    struct index_if {
-        using type = typename index_if_helper<0, sizeof...(Xs), false>
-            ::template f<Pred, Xs...>;
+    template <typename Pred>
+    struct make_index_if {
+        template <typename ...Xs>
+        constexpr auto operator()(Xs&& ...) const -> index_if<Pred, Xs&&...>
+        { return {}; }
     };
 } BOOST_HANA_NAMESPACE_END
 
@@ -0,0 +1,253 @@
+/*!
+@file
+Defines `boost::hana::detail::perfect_hash`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_PERFECT_HASH_HPP
+#define BOOST_HANA_DETAIL_PERFECT_HASH_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    namespace perfect_hash_detail {
+        // Reads up to 8 characters as a little-endian integer.
+        constexpr std::uint64_t load(char const* s, std::size_t size) {
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i != size; ++i)
+                word |= static_cast<std::uint64_t>(static_cast<unsigned char>(s[i])) << (8 * i);
+            return word;
+        }
+
+        // Same as `load(s, 8)`, but with a single load when possible.
+        inline std::uint64_t load8(char const* s) {
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+            std::uint64_t word;
+            std::memcpy(&word, s, 8);
+            return word;
+#else
+            return perfect_hash_detail::load(s, 8);
+#endif
+        }
+
+        inline std::uint64_t load4(char const* s) {
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+            std::uint32_t word;
+            std::memcpy(&word, s, 4);
+            return word;
+#else
+            return perfect_hash_detail::load(s, 4);
+#endif
+        }
+
+        // Same as `load(s, size)` for `size < 8`, using overlapping loads
+        // instead of a loop.
+        inline std::uint64_t load_tail(char const* s, std::size_t size) {
+            if (size >= 4)
+                return load4(s) | (load4(s + size - 4) << (8 * (size - 4)));
+            if (size == 0)
+                return 0;
+            return static_cast<std::uint64_t>(static_cast<unsigned char>(s[0]))
+                 | static_cast<std::uint64_t>(static_cast<unsigned char>(s[size / 2])) << (8 * (size / 2))
+                 | static_cast<std::uint64_t>(static_cast<unsigned char>(s[size - 1])) << (8 * (size - 1));
+        }
+
+        constexpr std::uint64_t hash_word(std::uint64_t h, std::uint64_t word)
+        { return (h ^ word) * 0xFF51AFD7ED558CCDull; }
+
+        constexpr std::uint64_t hash_tail(std::uint64_t h, std::uint64_t tail) {
+            h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+            return h ^ (h >> 32);
+        }
+
+        // Hashes 8 characters at a time. `hash` is used at compile-time and
+        // `runtime_hash` at runtime; they must always return the same value.
+        constexpr std::uint64_t hash(char const* s, std::size_t size) {
+            std::uint64_t h = size * 0x9E3779B97F4A7C15ull;
+            for (; size >= 8; s += 8, size -= 8)
+                h = hash_word(h, perfect_hash_detail::load(s, 8));
+            return hash_tail(h, perfect_hash_detail::load(s, size));
+        }
+
+        inline std::uint64_t runtime_hash(char const* s, std::size_t size) {
+            std::uint64_t h = size * 0x9E3779B97F4A7C15ull;
+            for (; size >= 8; s += 8, size -= 8)
+                h = hash_word(h, perfect_hash_detail::load8(s));
+            return hash_tail(h, perfect_hash_detail::load_tail(s, size));
+        }
+
+        inline bool equal(char const* a, char const* b, std::size_t size) {
+            for (; size >= 8; a += 8, b += 8, size -= 8)
+                if (perfect_hash_detail::load8(a) != perfect_hash_detail::load8(b))
+                    return false;
+            return perfect_hash_detail::load_tail(a, size) == perfect_hash_detail::load_tail(b, size);
+        }
+
+        // Derives a new hash from `h` for each `seed`.
+        constexpr std::uint64_t mix(std::uint64_t h, std::uint64_t seed) {
+            h ^= seed * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr std::size_t next_power_of_two(std::size_t n) {
+            std::size_t size = 1;
+            while (size < n)
+                size *= 2;
+            return size;
+        }
+
+        template <typename Key>
+        struct key_info;
+
+        template <char ...s>
+        struct key_info<hana::string<s...>> {
+            static constexpr std::size_t size = sizeof...(s);
+            static constexpr std::uint64_t hash = perfect_hash_detail::hash(
+                hana::string<s...>::c_str(), sizeof...(s));
+        };
+
+        // `seeds[b]` is the seed used by the keys whose hash falls in the
+        // bucket `b`, and `slots` maps the resulting hashes to the index of
+        // each key plus one, or to 0 for empty slots.
+        template <std::size_t Buckets, std::size_t Slots>
+        struct table {
+            std::uint32_t seeds[Buckets];
+            std::size_t slots[Slots];
+            bool ok;
+        };
+
+        // Builds the table with hash-and-displace: the buckets are given a
+        // seed in decreasing order of size, each seed being the first one
+        // sending all the keys of the bucket to free slots. There are twice
+        // as many slots as keys, so small seeds are normally found.
+        template <std::size_t Buckets, std::size_t Slots, std::size_t N>
+        constexpr table<Buckets, Slots> make_table(std::uint64_t const (&hashes)[N]) {
+            constexpr std::size_t keys = N - 1; // the last hash is a dummy
+            constexpr std::uint32_t max_seed = 1u << 16;
+            table<Buckets, Slots> t{};
+
+            // Sort the keys by bucket, and the buckets by decreasing size.
+            std::size_t first[Buckets + 1] = {};
+            for (std::size_t i = 0; i != keys; ++i)
+                ++first[(hashes[i] & (Buckets - 1)) + 1];
+            std::size_t by_size[keys + 2] = {};
+            for (std::size_t b = 0; b != Buckets; ++b)
+                ++by_size[first[b + 1]];
+            for (std::size_t size = keys; size != 0; --size)
+                by_size[size - 1] += by_size[size];
+            std::size_t buckets[Buckets] = {};
+            for (std::size_t b = 0; b != Buckets; ++b)
+                buckets[--by_size[first[b + 1]]] = b;
+
+            for (std::size_t b = 0; b != Buckets; ++b)
+                first[b + 1] += first[b];
+            std::size_t order[keys + 1] = {};
+            std::size_t next[Buckets] = {};
+            for (std::size_t i = 0; i != keys; ++i) {
+                std::size_t b = hashes[i] & (Buckets - 1);
+                order[first[b] + next[b]++] = i;
+            }
+
+            std::size_t taken[keys + 1] = {};
+            for (std::size_t n = 0; n != Buckets; ++n) {
+                std::size_t b = buckets[n];
+                if (first[b] == first[b + 1])
+                    break;
+
+                std::uint32_t seed = 1;
+                for (; seed != max_seed; ++seed) {
+                    std::size_t k = first[b];
+                    for (; k != first[b + 1]; ++k) {
+                        std::size_t i = order[k];
+                        std::size_t slot = mix(hashes[i], seed) & (Slots - 1);
+                        if (t.slots[slot] != 0)
+                            break;
+                        t.slots[slot] = i + 1;
+                        taken[k] = slot;
+                    }
+                    if (k == first[b + 1])
+                        break;
+
+                    // undo the slots taken by this bucket
+                    while (k != first[b])
+                        t.slots[taken[--k]] = 0;
+                }
+                if (seed == max_seed)
+                    return t;
+                t.seeds[b] = seed;
+            }
+
+            t.ok = true;
+            return t;
+        }
+    }
+
+    //! @ingroup group-details
+    //! Perfect hash function for a set of `hana::string`s, computed at
+    //! compile-time.
+    //!
+    //! `perfect_hash<Keys...>::find(s, size)` returns the index of the key
+    //! equal to the runtime string `[s, s + size)`, or `sizeof...(Keys)` if
+    //! there is no such key. This requires hashing the string once, and
+    //! comparing it to a single key.
+    template <typename ...Keys>
+    struct perfect_hash {
+        static constexpr std::size_t N = sizeof...(Keys);
+        static constexpr std::size_t Buckets = perfect_hash_detail::next_power_of_two(N / 2 + 1);
+        static constexpr std::size_t Slots = perfect_hash_detail::next_power_of_two(2 * N + 1);
+
+        static constexpr std::uint64_t hashes[N + 1] = {
+            perfect_hash_detail::key_info<Keys>::hash..., 0
+        };
+        static constexpr std::size_t sizes[N + 1] = {
+            perfect_hash_detail::key_info<Keys>::size..., 0
+        };
+        static constexpr char const* names[N + 1] = {Keys::c_str()..., nullptr};
+        static constexpr perfect_hash_detail::table<Buckets, Slots> table =
+            perfect_hash_detail::make_table<Buckets, Slots>(hashes);
+
+        static_assert(table.ok,
+        "hana::detail::perfect_hash: could not find a perfect hash function "
+        "for the given keys; make sure they are all different");
+
+        //! Returns whether the key at index `i` is equal to `[s, s + size)`.
+        static bool matches(std::size_t i, char const* s, std::size_t size) {
+            return sizes[i] == size && perfect_hash_detail::equal(names[i], s, size);
+        }
+
+        static std::size_t find(char const* s, std::size_t size) {
+            std::uint64_t h = perfect_hash_detail::runtime_hash(s, size);
+            std::uint32_t seed = table.seeds[h & (Buckets - 1)];
+            std::size_t slot = table.slots[perfect_hash_detail::mix(h, seed) & (Slots - 1)];
+            return slot != 0 && matches(slot - 1, s, size) ? slot - 1 : N;
+        }
+    };
+
+    template <typename ...Keys>
+    constexpr std::uint64_t perfect_hash<Keys...>::hashes[];
+
+    template <typename ...Keys>
+    constexpr std::size_t perfect_hash<Keys...>::sizes[];
+
+    template <typename ...Keys>
+    constexpr char const* perfect_hash<Keys...>::names[];
+
+    template <typename ...Keys>
+    constexpr perfect_hash_detail::table<
+        perfect_hash<Keys...>::Buckets, perfect_hash<Keys...>::Slots
+    > perfect_hash<Keys...>::table;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_PERFECT_HASH_HPP
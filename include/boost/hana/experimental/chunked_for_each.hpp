@@ -0,0 +1,146 @@
+/*!
+@file
+Defines `boost::hana::experimental::chunked_for_each`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_CHUNKED_FOR_EACH_HPP
+#define BOOST_HANA_EXPERIMENTAL_CHUNKED_FOR_EACH_HPP
+
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Calls a function with the value of each `Constant` of a structure,
+    //! using a runtime loop whose body calls the function `K` times.
+    //!
+    //! `hana::for_each(hana::range_c<int, 0, 2048>, f)` calls `f` with 2048
+    //! different `IntegralConstant`s, which creates 2048 copies of the body
+    //! of `f` in the executable. When `f` only needs the value of the index,
+    //! `chunked_for_each<K>(xs, f)` calls `f` with `hana::value(x)` for each
+    //! element `x` of `xs` instead, in order. This is done by a loop handling
+    //! `K` elements at each iteration, followed by a loop handling the
+    //! remaining elements, so that there are at most `K + 1` copies of the
+    //! body of `f` whatever the size of `xs`. `K` defaults to 8; a small `K`
+    //! favors the size of the executable, and a large `K` the unrolling.
+    //!
+    //! `xs` must be a `hana::range`, or a `Foldable` structure whose elements
+    //! are all `Constant`s, like `hana::tuple_c`. The values are converted
+    //! to the common type of the values of the elements. For sequences of
+    //! runtime values of a single type, like `std::array`, `hana::for_each`
+    //! already uses a runtime loop when the sequence is large.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/chunked_for_each.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <std::size_t K = 8>
+    constexpr auto chunked_for_each = [](auto&& xs, auto&& f) -> void {
+        tag-dispatched;
+    };
+#else
+    namespace chunked_for_each_detail {
+        template <typename Get, typename F, std::size_t ...k>
+        void chunk(Get const& get, std::size_t base, F& f, std::index_sequence<k...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(get(base + k)), 0)...};
+        }
+
+        template <std::size_t K, std::size_t N, typename Get, typename F>
+        void loop(Get const& get, F& f) {
+            constexpr std::size_t chunks = N / K;
+            for (std::size_t c = 0; c != chunks; ++c)
+                chunked_for_each_detail::chunk(get, c * K, f, std::make_index_sequence<K>{});
+            for (std::size_t i = chunks * K; i != N; ++i)
+                f(get(i));
+        }
+
+        template <typename T, T from>
+        struct range_get {
+            T operator()(std::size_t i) const
+            { return static_cast<T>(from + static_cast<T>(i)); }
+        };
+
+        template <typename T, std::size_t N>
+        struct values {
+            T value[N + 1]; // one more so it is never empty
+            T operator()(std::size_t i) const { return value[i]; }
+        };
+
+        template <typename T, std::size_t N>
+        struct make_values {
+            template <typename ...X>
+            constexpr values<T, N> operator()(X const& ...x) const
+            { return {{static_cast<T>(hana::value(x))..., T{}}}; }
+        };
+
+        template <typename ...X>
+        struct value_type {
+            using type = typename std::common_type<
+                typename detail::decay<decltype(hana::value<X>())>::type...
+            >::type;
+        };
+
+        // `f` is never called for empty structures.
+        template <>
+        struct value_type<> {
+            using type = int;
+        };
+
+        template <typename ...X>
+        struct common_value_type {
+            using type = typename value_type<typename detail::decay<X>::type...>::type;
+            template <typename ...Y>
+            constexpr common_value_type<Y...> operator()(Y&& ...) const { return {}; }
+        };
+    }
+
+    template <std::size_t K>
+    struct chunked_for_each_t {
+        static_assert(K != 0,
+        "hana::experimental::chunked_for_each<K> requires 'K' to be positive");
+
+        template <typename T, T from, T to, typename F>
+        void operator()(hana::range<T, from, to> const&, F&& f) const {
+            chunked_for_each_detail::loop<K, static_cast<std::size_t>(to - from)>(
+                chunked_for_each_detail::range_get<T, from>{}, f);
+        }
+
+        template <typename Xs, typename F>
+        void operator()(Xs const& xs, F&& f) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            using S = typename hana::tag_of<Xs>::type;
+            static_assert(hana::Foldable<S>::value,
+            "hana::experimental::chunked_for_each<K>(xs, f) requires 'xs' to be Foldable");
+        #endif
+
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            using T = typename decltype(hana::unpack(xs,
+                chunked_for_each_detail::common_value_type<>{}))::type;
+            chunked_for_each_detail::loop<K, N>(
+                hana::unpack(xs, chunked_for_each_detail::make_values<T, N>{}), f);
+        }
+    };
+
+    template <std::size_t K = 8>
+    constexpr chunked_for_each_t<K> chunked_for_each{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_CHUNKED_FOR_EACH_HPP
@@ -0,0 +1,1069 @@
+/*!
+@file
+Defines `boost::hana::experimental::to_json` and
+`boost::hana::experimental::from_json`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_JSON_HPP
+#define BOOST_HANA_EXPERIMENTAL_JSON_HPP
+
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
+#include <boost/hana/forward_members.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+// models for different containers
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/fwd/map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @cond
+    template <typename T, typename = void>
+    struct json_impl : json_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct json_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static void write(Args&& ...) = delete;
+
+        template <typename ...Args>
+        static void read(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Result of `from_json`, describing why its input could not be read.
+    //!
+    //! A `json_error` converts to `true` when the input was not valid JSON,
+    //! or did not match the type of the object being read, and to `false`
+    //! when it was read successfully.
+    class json_error {
+        char const* what_ = nullptr;
+        std::size_t position_ = 0;
+
+    public:
+        json_error() = default;
+
+        json_error(char const* what, std::size_t position)
+            : what_(what), position_(position)
+        { }
+
+        explicit operator bool() const { return what_ != nullptr; }
+
+        //! Description of the error, or an empty string if there is none.
+        char const* what() const { return what_ ? what_ : ""; }
+
+        //! Offset of the character at which the error was detected.
+        std::size_t position() const { return position_; }
+    };
+
+    //! @ingroup group-experimental
+    //! Appends the JSON representation of an object to a `std::string`.
+    //!
+    //! `to_json(buffer, x)` appends the JSON representation of `x` to the
+    //! caller-provided `buffer`, so the same buffer can be reused without
+    //! allocating. `to_json(x)` returns that representation in a new
+    //! `std::string`. This function is defined for
+    //! - `bool`s, which are written as `true` or `false`,
+    //! - arithmetic types, which are written as numbers (non-finite
+    //!   floating point numbers are written as `null`),
+    //! - `std::string`s, which are written as strings,
+    //! - `Struct`s and `hana::map`s whose keys are `hana::string`s, which
+    //!   are written as objects,
+    //! - `Sequence`s, `std::array`s and `std::vector`s, which are written
+    //!   as arrays.
+    //!
+    //! The names of the members of an object, their quotes and the
+    //! separators around them are escaped and concatenated at compile-time,
+    //! so writing the name of a member is a single copy. No whitespace is
+    //! added to the output.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/json.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto to_json = [](std::string& buffer, auto const& x) -> void {
+        return tag-dispatched;
+    };
+#else
+    struct to_json_t {
+        template <typename T>
+        void operator()(std::string& buffer, T const& t) const;
+
+        template <typename T>
+        std::string operator()(T const& t) const;
+    };
+
+    constexpr to_json_t to_json{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Reads an object from its JSON representation.
+    //!
+    //! `from_json(json, x)` reads the JSON value held in `json`, which is
+    //! either a `std::string` or a pair of `char const*` delimiting a
+    //! buffer, into `x`. The input is read in a single pass, and the same
+    //! types as for `to_json` are supported.
+    //!
+    //! When reading an object, each key is looked up with a perfect hash
+    //! function generated at compile-time from the names of the members,
+    //! unless it is the name of the member following the last member that
+    //! was read, which is checked first. Keys that do not name a member are ignored,
+    //! along with their value, and members whose name does not appear in
+    //! the input are left unchanged. Reading a `Struct` requires its
+    //! accessors to return references to its members.
+    //!
+    //! `from_json` returns a `json_error` converting to `true` if the input
+    //! is not valid JSON, if it does not match the type of `x`, if a number
+    //! does not fit in the member it is read into, or if arrays and objects
+    //! are nested more than `json_max_depth` levels deep. `x` may be
+    //! partially modified in that case.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/json.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto from_json = [](std::string const& json, auto& x) -> json_error {
+        return tag-dispatched;
+    };
+#else
+    struct from_json_t {
+        template <typename T>
+        json_error operator()(char const* first, char const* last, T& t) const;
+
+        template <typename T>
+        json_error operator()(std::string const& json, T& t) const;
+    };
+
+    constexpr from_json_t from_json{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Maximum number of nested arrays and objects accepted by `from_json`.
+    //!
+    //! This bounds the recursion done when reading the input, so that a
+    //! deeply nested input can't overflow the stack.
+    constexpr std::size_t json_max_depth = 256;
+
+    namespace json_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Reading
+        //////////////////////////////////////////////////////////////////////
+        // Once an error has been found, the input is considered exhausted,
+        // so that reading stops as soon as possible; only the first error
+        // is reported.
+        class input {
+            char const* begin_;
+            char const* first_;
+            char const* last_;
+            std::size_t depth_ = 0;
+            json_error error_;
+
+        public:
+            // Holds the unescaped keys containing escape sequences.
+            std::string scratch;
+
+            input(char const* first, char const* last)
+                : begin_(first), first_(first), last_(last)
+            { }
+
+            void error(char const* what) {
+                if (!error_)
+                    error_ = json_error{what, static_cast<std::size_t>(first_ - begin_)};
+                first_ = last_;
+            }
+
+            bool failed() const { return static_cast<bool>(error_); }
+
+            json_error const& result() const { return error_; }
+
+            bool done() const { return first_ == last_; }
+
+            char peek() const { return first_ == last_ ? '\0' : *first_; }
+
+            char get() {
+                if (first_ == last_) {
+                    error("hana::experimental::from_json: unexpected end of input");
+                    return '\0';
+                }
+                return *first_++;
+            }
+
+            // Consumes the bracket opening an array or an object.
+            void open(char c) {
+                expect(c);
+                if (++depth_ > json_max_depth)
+                    error("hana::experimental::from_json: too many nested arrays and objects");
+            }
+
+            // Consumes the bracket closing an array or an object, if it
+            // comes next.
+            bool close(char c) {
+                if (!consume(c))
+                    return false;
+                --depth_;
+                return true;
+            }
+
+            void expect_close(char c) {
+                if (!close(c))
+                    error("hana::experimental::from_json: unexpected character");
+            }
+
+            void skip_whitespace() {
+                while (first_ != last_ && (*first_ == ' ' || *first_ == '\n' ||
+                                           *first_ == '\r' || *first_ == '\t'))
+                    ++first_;
+            }
+
+            // Skips the whitespace and consumes `c` if it comes next.
+            bool consume(char c) {
+                skip_whitespace();
+                if (first_ != last_ && *first_ == c) {
+                    ++first_;
+                    return true;
+                }
+                return false;
+            }
+
+            void expect(char c) {
+                if (!consume(c))
+                    error("hana::experimental::from_json: unexpected character");
+            }
+
+            void expect_literal(char const* literal, std::size_t size) {
+                if (static_cast<std::size_t>(last_ - first_) < size ||
+                    std::memcmp(first_, literal, size) != 0)
+                    return error("hana::experimental::from_json: unexpected character");
+                first_ += size;
+            }
+
+            // Returns the number of characters of the number that comes next,
+            // which are not consumed, or 0 if they do not match the grammar
+            // of JSON numbers:
+            //
+            //      -? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)?
+            std::size_t number_size() const {
+                char const* p = first_;
+                auto digits = [&] {
+                    char const* start = p;
+                    while (p != last_ && *p >= '0' && *p <= '9')
+                        ++p;
+                    return p != start;
+                };
+
+                if (p != last_ && *p == '-')
+                    ++p;
+                if (p != last_ && *p == '0') {
+                    ++p;
+                    if (p != last_ && *p >= '0' && *p <= '9')
+                        return 0;
+                } else if (!digits()) {
+                    return 0;
+                }
+                if (p != last_ && *p == '.') {
+                    ++p;
+                    if (!digits())
+                        return 0;
+                }
+                if (p != last_ && (*p == 'e' || *p == 'E')) {
+                    ++p;
+                    if (p != last_ && (*p == '+' || *p == '-'))
+                        ++p;
+                    if (!digits())
+                        return 0;
+                }
+                return static_cast<std::size_t>(p - first_);
+            }
+
+            char const* position() const { return first_; }
+            void advance(std::size_t n) { first_ += n; }
+
+            void read_hex(unsigned& code) {
+                code = 0;
+                for (int i = 0; i != 4; ++i) {
+                    char c = get();
+                    code <<= 4;
+                    if (c >= '0' && c <= '9')      code |= static_cast<unsigned>(c - '0');
+                    else if (c >= 'a' && c <= 'f') code |= static_cast<unsigned>(c - 'a' + 10);
+                    else if (c >= 'A' && c <= 'F') code |= static_cast<unsigned>(c - 'A' + 10);
+                    else return error("hana::experimental::from_json: invalid escape sequence");
+                }
+            }
+
+            // Appends the character designated by the escape sequence
+            // starting after a backslash.
+            template <typename String>
+            void read_escape(String& out) {
+                char c = get();
+                switch (c) {
+                    case '"': case '\\': case '/': out.push_back(c); return;
+                    case 'b': out.push_back('\b'); return;
+                    case 'f': out.push_back('\f'); return;
+                    case 'n': out.push_back('\n'); return;
+                    case 'r': out.push_back('\r'); return;
+                    case 't': out.push_back('\t'); return;
+                    case 'u': break;
+                    default: return error("hana::experimental::from_json: invalid escape sequence");
+                }
+
+                unsigned code;
+                read_hex(code);
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    unsigned low;
+                    if (get() != '\\' || get() != 'u')
+                        return error("hana::experimental::from_json: invalid escape sequence");
+                    read_hex(low);
+                    if (low < 0xDC00 || low > 0xDFFF)
+                        return error("hana::experimental::from_json: invalid escape sequence");
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                if (failed())
+                    return;
+
+                if (code < 0x80) {
+                    out.push_back(static_cast<char>(code));
+                } else if (code < 0x800) {
+                    out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                } else if (code < 0x10000) {
+                    out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                    out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                } else {
+                    out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                    out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                }
+            }
+
+            // Appends the contents of a string whose opening quote was
+            // consumed, copying the runs of unescaped characters at once.
+            template <typename String>
+            void read_string_contents(String& out) {
+                while (true) {
+                    char const* run = first_;
+                    while (first_ != last_ && *first_ != '"' && *first_ != '\\') {
+                        if (static_cast<unsigned char>(*first_) < 0x20)
+                            return error("hana::experimental::from_json: unescaped control character in string");
+                        ++first_;
+                    }
+                    out.append(run, static_cast<std::size_t>(first_ - run));
+                    char c = get();
+                    if (c == '"' || failed())
+                        return;
+                    read_escape(out);
+                }
+            }
+
+            // Reads a key, pointing directly in the input when it does not
+            // contain escape sequences.
+            void read_key(char const*& key, std::size_t& size) {
+                key = first_;
+                size = 0;
+                expect('"');
+                char const* run = first_;
+                while (first_ != last_ && *first_ != '"' && *first_ != '\\')
+                    ++first_;
+                if (first_ != last_ && *first_ == '"') {
+                    key = run;
+                    size = static_cast<std::size_t>(first_ - run);
+                    ++first_;
+                    return;
+                }
+                scratch.assign(run, static_cast<std::size_t>(first_ - run));
+                read_string_contents(scratch);
+                key = scratch.data();
+                size = scratch.size();
+            }
+
+            void skip_string() {
+                while (!failed()) {
+                    char c = get();
+                    if (c == '"')
+                        return;
+                    if (c == '\\')
+                        get();
+                }
+            }
+
+            void skip_value() {
+                skip_whitespace();
+                switch (peek()) {
+                    case '"':
+                        ++first_;
+                        skip_string();
+                        return;
+                    case '{':
+                        open('{');
+                        if (close('}'))
+                            return;
+                        do {
+                            expect('"');
+                            skip_string();
+                            expect(':');
+                            skip_value();
+                        } while (consume(','));
+                        expect_close('}');
+                        return;
+                    case '[':
+                        open('[');
+                        if (close(']'))
+                            return;
+                        do {
+                            skip_value();
+                        } while (consume(','));
+                        expect_close(']');
+                        return;
+                    case 't': expect_literal("true", 4); return;
+                    case 'f': expect_literal("false", 5); return;
+                    case 'n': expect_literal("null", 4); return;
+                    default:
+                        std::size_t n = number_size();
+                        if (n == 0)
+                            return error(done()
+                                ? "hana::experimental::from_json: unexpected end of input"
+                                : "hana::experimental::from_json: unexpected character");
+                        first_ += n;
+                }
+            }
+        };
+
+        // Converts with the function matching the floating point type, so
+        // that the result is never narrowed after the conversion.
+        inline float strto(char const* s, char** end, float*)
+        { return std::strtof(s, end); }
+
+        inline double strto(char const* s, char** end, double*)
+        { return std::strtod(s, end); }
+
+        inline long double strto(char const* s, char** end, long double*)
+        { return std::strtold(s, end); }
+
+        template <typename T>
+        void read(input& in, T& t) {
+            using Tag = typename hana::tag_of<T>::type;
+            json_impl<Tag>::read(in, t);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Writing
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        void write(std::string& out, T const& t) {
+            using Tag = typename hana::tag_of<T>::type;
+            json_impl<Tag>::write(out, t);
+        }
+
+        inline char hex_digit(unsigned x) {
+            return "0123456789abcdef"[x & 0xF];
+        }
+
+        // Writes a string, copying the runs of characters that need not be
+        // escaped at once.
+        inline void write_string(std::string& out, char const* s, std::size_t size) {
+            out.push_back('"');
+            char const* run = s;
+            char const* last = s + size;
+            for (; s != last; ++s) {
+                unsigned char c = static_cast<unsigned char>(*s);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                    continue;
+                out.append(run, static_cast<std::size_t>(s - run));
+                run = s + 1;
+                switch (c) {
+                    case '"': out.append("\\\"", 2); break;
+                    case '\\': out.append("\\\\", 2); break;
+                    case '\b': out.append("\\b", 2); break;
+                    case '\f': out.append("\\f", 2); break;
+                    case '\n': out.append("\\n", 2); break;
+                    case '\r': out.append("\\r", 2); break;
+                    case '\t': out.append("\\t", 2); break;
+                    default: {
+                        char escape[] = {'\\', 'u', '0', '0',
+                                         hex_digit(c >> 4), hex_digit(c)};
+                        out.append(escape, sizeof escape);
+                    }
+                }
+            }
+            out.append(run, static_cast<std::size_t>(last - run));
+            out.push_back('"');
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Objects
+        //////////////////////////////////////////////////////////////////////
+        constexpr std::size_t escaped_size(char c) {
+            return c == '"' || c == '\\' || c == '\b' || c == '\f' ||
+                   c == '\n' || c == '\r' || c == '\t' ? 2
+                 : static_cast<unsigned char>(c) < 0x20 ? 6
+                 : 1;
+        }
+
+        template <char ...c>
+        constexpr std::size_t escaped_size() {
+            constexpr char s[] = {c..., '\0'};
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != sizeof...(c); ++i)
+                size += escaped_size(s[i]);
+            return size;
+        }
+
+        template <std::size_t N>
+        struct literal {
+            char data[N];
+            static constexpr std::size_t size = N;
+        };
+
+        // Builds `<prefix>"<escaped key>":`.
+        template <char prefix, char ...c>
+        constexpr literal<escaped_size<c...>() + 4> make_key_literal() {
+            constexpr char s[] = {c..., '\0'};
+            constexpr char hex[] = "0123456789abcdef";
+            literal<escaped_size<c...>() + 4> result{};
+            std::size_t n = 0;
+            result.data[n++] = prefix;
+            result.data[n++] = '"';
+            for (std::size_t i = 0; i != sizeof...(c); ++i) {
+                char x = s[i];
+                char escape = x == '"' ? '"' : x == '\\' ? '\\' : x == '\b' ? 'b'
+                            : x == '\f' ? 'f' : x == '\n' ? 'n' : x == '\r' ? 'r'
+                            : x == '\t' ? 't' : '\0';
+                if (escape != '\0') {
+                    result.data[n++] = '\\';
+                    result.data[n++] = escape;
+                } else if (static_cast<unsigned char>(x) < 0x20) {
+                    result.data[n++] = '\\';
+                    result.data[n++] = 'u';
+                    result.data[n++] = '0';
+                    result.data[n++] = '0';
+                    result.data[n++] = hex[static_cast<unsigned char>(x) >> 4];
+                    result.data[n++] = hex[static_cast<unsigned char>(x) & 0xF];
+                } else {
+                    result.data[n++] = x;
+                }
+            }
+            result.data[n++] = '"';
+            result.data[n++] = ':';
+            return result;
+        }
+
+        template <char prefix, typename Key>
+        struct key_literal {
+            static_assert(sizeof(Key) && false,
+            "hana::experimental::to_json requires the keys of objects to be hana::strings");
+        };
+
+        template <char prefix, char ...c>
+        struct key_literal<prefix, hana::string<c...>> {
+            static constexpr decltype(make_key_literal<prefix, c...>()) value
+                = make_key_literal<prefix, c...>();
+        };
+
+        template <char prefix, char ...c>
+        constexpr decltype(make_key_literal<prefix, c...>())
+        key_literal<prefix, hana::string<c...>>::value;
+
+        template <typename Keys>
+        struct object;
+
+        template <template <typename ...> class Tuple, typename ...Keys>
+        struct object<Tuple<Keys...>> {
+            static constexpr std::size_t N = sizeof...(Keys);
+
+            template <std::size_t ...i, typename ...Values>
+            static void write_members(std::string& out, std::index_sequence<i...>,
+                                      Values const& ...values)
+            {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    out.append(key_literal<i == 0 ? '{' : ',', Keys>::value.data,
+                               key_literal<i == 0 ? '{' : ',', Keys>::value.size),
+                    json_detail::write(out, values)
+                ), 0)...};
+            }
+
+            template <typename ...Values>
+            static void write(std::string& out, Values const& ...values) {
+                if (N == 0) {
+                    out.append("{}", 2);
+                } else {
+                    write_members(out, std::index_sequence_for<Keys...>{}, values...);
+                    out.push_back('}');
+                }
+            }
+
+            using Hash = detail::perfect_hash<Keys...>;
+
+            template <std::size_t i, typename Members>
+            static void read_member(input& in, Members& members)
+            { json_detail::read(in, hana::at_c<i>(members)); }
+
+            template <typename Members, std::size_t ...i>
+            static void read(input& in, Members& members, std::index_sequence<i...>) {
+                using Handler = void(*)(input&, Members&);
+                static constexpr Handler handlers[N + 1] = {
+                    &read_member<i, Members>..., nullptr
+                };
+
+                in.open('{');
+                if (in.close('}'))
+                    return;
+
+                std::size_t next = 0;
+                do {
+                    char const* key;
+                    std::size_t size;
+                    in.read_key(key, size);
+                    in.expect(':');
+                    if (in.failed())
+                        return;
+
+                    // Objects usually list their members in order, so the
+                    // member after the previous one is tried first.
+                    std::size_t index = next < N && Hash::matches(next, key, size)
+                                            ? next : Hash::find(key, size);
+                    if (index < N) {
+                        handlers[index](in, members);
+                        next = index + 1;
+                    } else {
+                        in.skip_value();
+                    }
+                } while (in.consume(','));
+                in.expect_close('}');
+            }
+
+            // `members` is a `hana::tuple` of references to the members.
+            template <typename Members>
+            static void read(input& in, Members& members)
+            { read(in, members, std::index_sequence_for<Keys...>{}); }
+        };
+
+        template <typename Members>
+        struct holds_mutable_references;
+
+        template <typename ...T>
+        struct holds_mutable_references<hana::tuple<T...>>
+            : detail::fast_and<(
+                std::is_lvalue_reference<T>::value &&
+                !std::is_const<typename std::remove_reference<T>::type>::value
+            )...>
+        { };
+
+        //////////////////////////////////////////////////////////////////////
+        // Arrays
+        //////////////////////////////////////////////////////////////////////
+        struct write_elements {
+            std::string& out;
+
+            template <typename ...X>
+            void operator()(X const& ...x) const {
+                out.push_back('[');
+                bool first = true;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    first ? (void)(first = false) : out.push_back(','),
+                    json_detail::write(out, x)
+                ), 0)...};
+                (void)first; // unused when there are no elements
+                out.push_back(']');
+            }
+        };
+
+        struct read_elements {
+            input& in;
+
+            template <typename ...X>
+            void operator()(X& ...x) const {
+                in.open('[');
+                bool first = true;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    first ? (void)(first = false) : in.expect(','),
+                    json_detail::read(in, x)
+                ), 0)...};
+                (void)first; // unused when there are no elements
+                in.expect_close(']');
+            }
+        };
+
+        template <typename Range>
+        void write_range(std::string& out, Range const& range) {
+            out.push_back('[');
+            bool first = true;
+            for (auto const& x : range) {
+                if (!first)
+                    out.push_back(',');
+                first = false;
+                json_detail::write(out, static_cast<
+                    typename Range::value_type const&>(x));
+            }
+            out.push_back(']');
+        }
+    }
+
+    //! @cond
+    template <typename T>
+    void to_json_t::operator()(std::string& buffer, T const& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using ToJson = BOOST_HANA_DISPATCH_IF(json_impl<Tag>,
+            !hana::is_default<json_impl<Tag>>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(!hana::is_default<json_impl<Tag>>::value,
+        "hana::experimental::to_json(buffer, t) requires 't' to have a JSON representation");
+    #endif
+
+        ToJson::write(buffer, t);
+    }
+
+    template <typename T>
+    std::string to_json_t::operator()(T const& t) const {
+        std::string buffer;
+        (*this)(buffer, t);
+        return buffer;
+    }
+
+    template <typename T>
+    json_error from_json_t::operator()(char const* first, char const* last, T& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using FromJson = BOOST_HANA_DISPATCH_IF(json_impl<Tag>,
+            !hana::is_default<json_impl<Tag>>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(!hana::is_default<json_impl<Tag>>::value,
+        "hana::experimental::from_json(json, t) requires 't' to have a JSON representation");
+    #endif
+
+        json_detail::input in{first, last};
+        FromJson::read(in, t);
+        in.skip_whitespace();
+        if (!in.done())
+            in.error("hana::experimental::from_json: unexpected characters after the value");
+        return in.result();
+    }
+
+    template <typename T>
+    json_error from_json_t::operator()(std::string const& json, T& t) const {
+        return (*this)(json.data(), json.data() + json.size(), t);
+    }
+    //! @endcond
+
+    // model for bools
+    template <>
+    struct json_impl<bool> {
+        static void write(std::string& out, bool b) {
+            if (b) out.append("true", 4);
+            else   out.append("false", 5);
+        }
+
+        static void read(json_detail::input& in, bool& b) {
+            in.skip_whitespace();
+            if (in.peek() == 't') {
+                in.expect_literal("true", 4);
+                b = true;
+            } else {
+                in.expect_literal("false", 5);
+                b = false;
+            }
+        }
+    };
+
+    // model for integral types
+    template <typename T>
+    struct json_impl<T, hana::when<
+        std::is_integral<T>::value && !std::is_same<T, bool>::value
+    >> {
+        using U = typename std::make_unsigned<T>::type;
+
+        static U magnitude(T x, bool& negative, std::true_type /* signed */) {
+            negative = x < 0;
+            return negative ? static_cast<U>(U(0) - static_cast<U>(x))
+                            : static_cast<U>(x);
+        }
+
+        static U magnitude(T x, bool& negative, std::false_type)
+        { negative = false; return x; }
+
+        static void write(std::string& out, T x) {
+            char buffer[std::numeric_limits<U>::digits10 + 3];
+            char* last = buffer + sizeof buffer;
+            char* first = last;
+            bool negative;
+            U u = magnitude(x, negative, std::is_signed<T>{});
+            do {
+                *--first = static_cast<char>('0' + u % 10);
+                u = static_cast<U>(u / 10);
+            } while (u != 0);
+            if (negative)
+                *--first = '-';
+            out.append(first, static_cast<std::size_t>(last - first));
+        }
+
+        static void read(json_detail::input& in, T& x) {
+            in.skip_whitespace();
+            std::size_t n = in.number_size();
+            if (n == 0)
+                return in.error("hana::experimental::from_json: expected a number");
+
+            bool negative = in.peek() == '-';
+            if (negative) {
+                in.advance(1);
+                --n;
+            }
+            char const* p = in.position();
+
+            std::uintmax_t limit = negative
+                ? static_cast<std::uintmax_t>(0) - static_cast<std::uintmax_t>(std::numeric_limits<T>::min())
+                : static_cast<std::uintmax_t>(std::numeric_limits<T>::max());
+            std::uintmax_t value = 0;
+            for (std::size_t i = 0; i != n; ++i) {
+                if (p[i] < '0' || p[i] > '9')
+                    return in.error("hana::experimental::from_json: expected an integer");
+                unsigned digit = static_cast<unsigned>(p[i] - '0');
+                if (value > limit / 10 || (value == limit / 10 && digit > limit % 10))
+                    return in.error("hana::experimental::from_json: integer out of range");
+                value = value * 10 + digit;
+            }
+            in.advance(n);
+            x = negative ? static_cast<T>(static_cast<T>(-static_cast<std::intmax_t>(value - 1)) - 1)
+                         : static_cast<T>(value);
+        }
+    };
+
+    // model for floating point types
+    //
+    // snprintf and strtod use the decimal point of the current C locale,
+    // so it is replaced by (or substituted for) the '.' required by JSON.
+    template <typename T>
+    struct json_impl<T, hana::when<std::is_floating_point<T>::value>> {
+        static void write(std::string& out, T x) {
+            if (!std::isfinite(x)) {
+                out.append("null", 4);
+                return;
+            }
+            char buffer[64];
+            int n = std::is_same<T, long double>::value
+                ? std::snprintf(buffer, sizeof buffer, "%.*Lg",
+                    std::numeric_limits<T>::max_digits10, static_cast<long double>(x))
+                : std::snprintf(buffer, sizeof buffer, "%.*g",
+                    std::numeric_limits<T>::max_digits10, static_cast<double>(x));
+
+            char const* point = std::localeconv()->decimal_point;
+            std::size_t point_size = std::strlen(point);
+            char const* first = buffer;
+            char const* last = buffer + n;
+            char const* p = point_size == 0 ? last
+                          : std::search(first, last, point, point + point_size);
+            if (p == last) {
+                out.append(first, static_cast<std::size_t>(n));
+            } else {
+                out.append(first, static_cast<std::size_t>(p - first));
+                out.push_back('.');
+                out.append(p + point_size, static_cast<std::size_t>(last - p - point_size));
+            }
+        }
+
+        static void read(json_detail::input& in, T& x) {
+            in.skip_whitespace();
+            if (in.peek() == 'n') {
+                in.expect_literal("null", 4);
+                x = std::numeric_limits<T>::quiet_NaN();
+                return;
+            }
+
+            std::size_t n = in.number_size();
+            if (n == 0)
+                return in.error("hana::experimental::from_json: expected a number");
+
+            // strtod needs a null-terminated string, which is built on the
+            // stack unless the number is unusually long.
+            char const* point = std::localeconv()->decimal_point;
+            std::size_t point_size = std::strlen(point);
+            char small[64];
+            std::string large;
+            char* buffer = small;
+            if (n + point_size >= sizeof small) {
+                large.resize(n + point_size + 1);
+                buffer = &large[0];
+            }
+
+            char const* number = in.position();
+            char* last = buffer;
+            for (std::size_t i = 0; i != n; ++i) {
+                if (number[i] == '.') {
+                    std::memcpy(last, point, point_size);
+                    last += point_size;
+                } else {
+                    *last++ = number[i];
+                }
+            }
+            *last = '\0';
+
+            char* end;
+            errno = 0;
+            T value = json_detail::strto(buffer, &end, static_cast<T*>(nullptr));
+            if (end != last)
+                return in.error("hana::experimental::from_json: expected a number");
+            // Numbers too small for `T` are rounded, but numbers too large
+            // are rejected instead of being read as an infinity.
+            if (errno == ERANGE && std::isinf(value))
+                return in.error("hana::experimental::from_json: number out of range");
+            in.advance(n);
+            x = value;
+        }
+    };
+
+    // model for std::strings
+    template <typename Traits, typename Allocator>
+    struct json_impl<std::basic_string<char, Traits, Allocator>> {
+        static void write(std::string& out, std::basic_string<char, Traits, Allocator> const& s)
+        { json_detail::write_string(out, s.data(), s.size()); }
+
+        static void read(json_detail::input& in, std::basic_string<char, Traits, Allocator>& s) {
+            in.expect('"');
+            s.clear();
+            in.read_string_contents(s);
+        }
+    };
+
+    // model for Structs
+    template <typename S>
+    struct json_impl<S, hana::when<hana::Struct<S>::value>> {
+        using Object = json_detail::object<
+            decltype(hana::keys(std::declval<S const&>()))
+        >;
+
+        template <typename T>
+        static void write(std::string& out, T const& t) {
+            hana::unpack(hana::forward_members(t), [&out](auto const& ...member) {
+                Object::write(out, member...);
+            });
+        }
+
+        template <typename T>
+        static void read(json_detail::input& in, T& t) {
+            auto members = hana::forward_members(t);
+            static_assert(json_detail::holds_mutable_references<decltype(members)>::value,
+            "hana::experimental::from_json(json, t) requires the accessors "
+            "of the Struct 't' to return references to its members");
+            Object::read(in, members);
+        }
+    };
+
+    // model for hana::maps
+    template <>
+    struct json_impl<hana::map_tag> {
+        template <typename M>
+        static void write(std::string& out, M const& map) {
+            using Object = json_detail::object<decltype(hana::keys(map))>;
+            hana::unpack(map, [&out](auto const& ...pair) {
+                Object::write(out, hana::second(pair)...);
+            });
+        }
+
+        template <typename M>
+        static void read(json_detail::input& in, M& map) {
+            using Object = json_detail::object<decltype(hana::keys(map))>;
+            auto values = hana::unpack(map, [](auto& ...pair) {
+                return hana::tuple<decltype(hana::second(pair))...>{
+                    hana::second(pair)...
+                };
+            });
+            Object::read(in, values);
+        }
+    };
+
+    // model for Sequences
+    template <typename S>
+    struct json_impl<S, hana::when<hana::Sequence<S>::value>> {
+        template <typename Xs>
+        static void write(std::string& out, Xs const& xs)
+        { hana::unpack(xs, json_detail::write_elements{out}); }
+
+        template <typename Xs>
+        static void read(json_detail::input& in, Xs& xs)
+        { hana::unpack(xs, json_detail::read_elements{in}); }
+    };
+
+    // model for std::arrays
+    template <>
+    struct json_impl<hana::ext::std::array_tag> {
+        template <typename T, std::size_t N>
+        static void write(std::string& out, std::array<T, N> const& a)
+        { json_detail::write_range(out, a); }
+
+        template <typename T, std::size_t N>
+        static void read(json_detail::input& in, std::array<T, N>& a) {
+            in.open('[');
+            for (std::size_t i = 0; i != N && !in.failed(); ++i) {
+                if (i != 0)
+                    in.expect(',');
+                json_detail::read(in, a[i]);
+            }
+            in.expect_close(']');
+        }
+    };
+
+    // model for std::vectors
+    template <>
+    struct json_impl<hana::ext::std::vector_tag> {
+        template <typename T, typename Allocator>
+        static void write(std::string& out, std::vector<T, Allocator> const& v)
+        { json_detail::write_range(out, v); }
+
+        template <typename T, typename Allocator>
+        static void read(json_detail::input& in, std::vector<T, Allocator>& v) {
+            v.clear();
+            in.open('[');
+            if (in.close(']'))
+                return;
+            do {
+                T x{};
+                json_detail::read(in, x);
+                v.push_back(std::move(x));
+            } while (in.consume(','));
+            in.expect_close(']');
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_JSON_HPP
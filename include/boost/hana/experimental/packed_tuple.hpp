@@ -0,0 +1,285 @@
+/*!
+@file
+Defines `boost::hana::experimental::packed_tuple`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
+#define BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
+
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/iterable.hpp>
+#include <boost/hana/detail/operators/monad.hpp>
+#include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concept/sequence.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Tuple storing its elements in an order minimizing padding.
+        //!
+        //! `hana::tuple` stores its elements in the order in which they are
+        //! given, which wastes space when types with different alignments
+        //! are interleaved; `hana::tuple<char, double, char, int>` usually
+        //! takes 24 bytes. `packed_tuple` instead stores its elements by
+        //! decreasing alignment, so that `packed_tuple<char, double, char, int>`
+        //! takes 16 bytes. This reordering is only a matter of storage: the
+        //! elements are still accessed, iterated over and compared in the
+        //! order in which they are given.
+        //!
+        //! The storage order is computed at compile-time, and accessing an
+        //! element is as cheap as with `hana::tuple`. Elements with the same
+        //! alignment are kept in their relative order.
+        //!
+        //!
+        //! Modeled concepts
+        //! ----------------
+        //! `Sequence`, and all the concepts it refines
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/packed_tuple.cpp
+        template <typename ...Xn>
+        struct packed_tuple;
+
+        //! Tag representing `hana::experimental::packed_tuple`.
+        //! @relates hana::experimental::packed_tuple
+        struct packed_tuple_tag { };
+
+        //! Function object for creating a `packed_tuple`.
+        //! @relates hana::experimental::packed_tuple
+        //!
+        //! This is equivalent to `hana::make<packed_tuple_tag>`.
+        constexpr auto make_packed_tuple = make<packed_tuple_tag>;
+
+        namespace packed_tuple_detail {
+            // `storage[k]` is the index of the element stored at position `k`,
+            // and `position[i]` is the position at which the `i`-th element
+            // is stored. The arrays have an additional unused entry so they
+            // are never empty.
+            template <std::size_t N>
+            struct layout {
+                std::size_t storage[N + 1];
+                std::size_t position[N + 1];
+            };
+
+            // Stable insertion sort of the elements by decreasing alignment.
+            template <std::size_t N>
+            constexpr layout<N> make_layout(std::size_t const (&alignments)[N + 1]) {
+                layout<N> l{};
+                for (std::size_t i = 0; i != N; ++i) {
+                    std::size_t k = i;
+                    for (; k != 0 && alignments[l.storage[k - 1]] < alignments[i]; --k)
+                        l.storage[k] = l.storage[k - 1];
+                    l.storage[k] = i;
+                }
+                for (std::size_t k = 0; k != N; ++k)
+                    l.position[l.storage[k]] = k;
+                return l;
+            }
+
+            template <typename Indices, typename ...Xn>
+            struct layout_for_impl;
+
+            template <std::size_t ...i, typename ...Xn>
+            struct layout_for_impl<std::index_sequence<i...>, Xn...> {
+                static constexpr std::size_t size = sizeof...(Xn);
+                static constexpr std::size_t alignments[sizeof...(Xn) + 1] = {
+                    alignof(Xn)..., 0
+                };
+                static constexpr layout<sizeof...(Xn)> value =
+                    packed_tuple_detail::make_layout<sizeof...(Xn)>(alignments);
+
+                using storage_type = hana::basic_tuple<
+                    typename detail::type_at<value.storage[i], Xn...>::type...
+                >;
+                using storage_indices = std::index_sequence<value.storage[i]...>;
+                using positions = std::index_sequence<value.position[i]...>;
+            };
+
+            template <std::size_t ...i, typename ...Xn>
+            constexpr std::size_t
+            layout_for_impl<std::index_sequence<i...>, Xn...>::alignments[];
+
+            template <std::size_t ...i, typename ...Xn>
+            constexpr layout<sizeof...(Xn)>
+            layout_for_impl<std::index_sequence<i...>, Xn...>::value;
+
+            template <typename ...Xn>
+            using layout_for = layout_for_impl<
+                std::make_index_sequence<sizeof...(Xn)>, Xn...
+            >;
+
+            struct from_args { };
+        }
+
+        //! @cond
+        template <typename ...Xn>
+        struct packed_tuple
+            : detail::operators::adl<packed_tuple<Xn...>>
+            , detail::iterable_operators<packed_tuple<Xn...>>
+        {
+            using layout_ = packed_tuple_detail::layout_for<Xn...>;
+            typename layout_::storage_type storage_;
+
+        private:
+            template <typename Args, std::size_t ...k>
+            constexpr packed_tuple(packed_tuple_detail::from_args, Args&& args,
+                                   std::index_sequence<k...>)
+                : storage_(std::get<k>(static_cast<Args&&>(args))...)
+            { }
+
+        public:
+            constexpr packed_tuple() = default;
+
+            template <typename ...Yn, typename = typename std::enable_if<
+                sizeof...(Yn) == sizeof...(Xn) && sizeof...(Yn) != 0 &&
+                detail::fast_and<std::is_constructible<Xn, Yn&&>::value...>::value
+            >::type>
+            constexpr packed_tuple(Yn&& ...yn)
+                : packed_tuple(packed_tuple_detail::from_args{},
+                               std::forward_as_tuple(static_cast<Yn&&>(yn)...),
+                               typename layout_::storage_indices{})
+            { }
+        };
+        //! @endcond
+    } // end namespace experimental
+
+    template <typename ...Xn>
+    struct tag_of<experimental::packed_tuple<Xn...>> {
+        using type = experimental::packed_tuple_tag;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<experimental::packed_tuple_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct orderable_operators<experimental::packed_tuple_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct monad_operators<experimental::packed_tuple_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<experimental::packed_tuple_tag> {
+        template <typename Xs, typename F, std::size_t ...p>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, std::index_sequence<p...>) {
+            return static_cast<F&&>(f)(
+                hana::at_c<p>(static_cast<Xs&&>(xs).storage_)...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Positions = typename detail::decay<Xs>::type::layout_::positions;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 Positions{});
+        }
+    };
+
+    template <>
+    struct length_impl<experimental::packed_tuple_tag> {
+        template <typename ...Xn>
+        static constexpr auto apply(experimental::packed_tuple<Xn...> const&) {
+            return hana::size_t<sizeof...(Xn)>{};
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<experimental::packed_tuple_tag> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            using Layout = typename detail::decay<Xs>::type::layout_;
+            constexpr std::size_t position = Layout::value.position[N::value];
+            return hana::at_c<position>(static_cast<Xs&&>(xs).storage_);
+        }
+    };
+
+    template <>
+    struct drop_front_impl<experimental::packed_tuple_tag> {
+        template <std::size_t N, typename Xs, std::size_t ...i>
+        static constexpr auto drop_front_helper(Xs&& xs, std::index_sequence<i...>) {
+            using Layout = typename detail::decay<Xs>::type::layout_;
+            return experimental::make_packed_tuple(
+                hana::at_c<Layout::value.position[i + N]>(static_cast<Xs&&>(xs).storage_)...
+            );
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t len = detail::decay<Xs>::type::layout_::size;
+            return drop_front_helper<N::value>(static_cast<Xs&&>(xs), std::make_index_sequence<
+                (N::value < len) ? len - N::value : 0
+            >{});
+        }
+    };
+
+    template <>
+    struct is_empty_impl<experimental::packed_tuple_tag> {
+        template <typename ...Xn>
+        static constexpr hana::bool_<sizeof...(Xn) == 0>
+        apply(experimental::packed_tuple<Xn...> const&)
+        { return {}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct Sequence<experimental::packed_tuple_tag> {
+        static constexpr bool value = true;
+    };
+
+    template <>
+    struct make_impl<experimental::packed_tuple_tag> {
+        template <typename ...Xn>
+        static constexpr experimental::packed_tuple<typename detail::decay<Xn>::type...>
+        apply(Xn&& ...xn) {
+            return experimental::packed_tuple<typename detail::decay<Xn>::type...>{
+                static_cast<Xn&&>(xn)...
+            };
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
@@ -0,0 +1,832 @@
+/*!
+@file
+Defines `boost::hana::experimental::serialize` and
+`boost::hana::experimental::deserialize`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
+#define BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/concept/product.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/struct_macros.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/forward_members.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+// models for different containers
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/fwd/map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    template <typename T>
+    struct Serializable;
+
+    //! @cond
+    template <typename T, typename = void>
+    struct serialize_impl : serialize_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct serialize_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static void save(Args&& ...) = delete;
+
+        template <typename ...Args>
+        static void load(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    //! @ingroup group-experimental
+    //! Writes the binary representation of an object to a `Writer`.
+    //!
+    //! `serialize(writer, x)` calls `writer.write(data, size)` with
+    //! consecutive blocks of bytes representing `x`, where `data` is a
+    //! `char const*`. `serialize(x)` returns these bytes in a `std::string`.
+    //! This function is defined for
+    //! - trivially copyable types that are not `Struct`s or Hana containers,
+    //!   such as arithmetic types, which are written as is,
+    //! - `bool`s, which are written as a single byte, and enumerations,
+    //!   which are written as their underlying type,
+    //! - `Struct`s, `Sequence`s and `Product`s, whose elements are written
+    //!   one after the other,
+    //! - `hana::map`s, whose values are written one after the other (the
+    //!   keys being known at compile-time, they are not written),
+    //! - `Constant`s, which are not written at all,
+    //! - `std::array`s, `std::vector`s and `std::basic_string`s, whose
+    //!   elements are preceded by their number in the case of `std::vector`
+    //!   and `std::basic_string`.
+    //!
+    //! The members of a `Struct` defined with `BOOST_HANA_DEFINE_STRUCT`
+    //! are declared in the order of its accessors, so the size, alignment
+    //! and type of each member tell at compile-time which consecutive
+    //! members can not be separated by padding. Such runs of members that
+    //! are written as is are written with a single call to `writer.write`,
+    //! and so are `Struct`s made of a single run, like a `Point` holding
+    //! three `int`s, and arrays of them. The members of other `Struct`s are
+    //! written one at a time.
+    //!
+    //! The representation of arithmetic types is the one used in memory,
+    //! without the padding between the members of `Struct`s, but with the
+    //! padding inside other trivially copyable types. Hence, it can only be
+    //! read back on platforms with the same size and endianness for these
+    //! types.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/serialize.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto serialize = [](auto& writer, auto const& x) -> void {
+        return tag-dispatched;
+    };
+#else
+    struct serialize_t {
+        template <typename Writer, typename T>
+        void operator()(Writer& writer, T const& t) const;
+
+        template <typename T>
+        std::string operator()(T const& t) const;
+    };
+
+    constexpr serialize_t serialize{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Reads an object written by `serialize` from a `Reader`.
+    //!
+    //! `deserialize(reader, x)` calls `reader.read(data, size)` to fill the
+    //! representation of `x` written by `serialize`, where `data` is a
+    //! `char*`. `reader.read` must return `false` when it does not have the
+    //! requested number of bytes, in which case `deserialize` stops reading
+    //! and returns `false`; otherwise, it returns `true`. After a failure,
+    //! `x` is left in a valid but unspecified state. `bool`s are validated
+    //! as they are read, and enumerations are read through their underlying
+    //! type, so no invalid value is ever stored. The members of `Struct`s
+    //! are read in place, which requires the accessors of the `Struct` to
+    //! return references to its members, and the size of `std::vector`s and
+    //! `std::basic_string`s is adjusted as needed.
+    //!
+    //! The sizes of containers are read from the input, so they can not be
+    //! trusted. When the reader has a `remaining()` function returning the
+    //! number of bytes it has left, like `buffer_reader`, sizes that would
+    //! require more bytes than that are rejected before allocating anything.
+    //! Otherwise, containers are grown as their elements are actually read.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/serialize.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto deserialize = [](auto& reader, auto& x) -> bool {
+        return tag-dispatched;
+    };
+#else
+    struct deserialize_t {
+        template <typename Reader, typename T>
+        bool operator()(Reader& reader, T& t) const;
+    };
+
+    constexpr deserialize_t deserialize{};
+#endif
+
+    // Define the `Serializable` concept
+    template <typename T>
+    struct Serializable {
+        using Tag = typename hana::tag_of<T>::type;
+        static constexpr bool value = !hana::is_default<serialize_impl<Tag>>::value;
+    };
+
+    //! @ingroup group-experimental
+    //! Writer appending the bytes written by `serialize` to a `std::string`.
+    struct string_writer {
+        std::string& buffer;
+
+        void write(char const* data, std::size_t size)
+        { buffer.append(data, size); }
+    };
+
+    //! @ingroup group-experimental
+    //! Reader providing `deserialize` with the bytes of a contiguous buffer.
+    //!
+    //! The buffer is not copied, so it must outlive the reader. Reading
+    //! more bytes than what remains in the buffer fails without reading
+    //! anything.
+    class buffer_reader {
+        char const* first_;
+        char const* last_;
+
+    public:
+        buffer_reader(char const* data, std::size_t size)
+            : first_(data), last_(data + size)
+        { }
+
+        explicit buffer_reader(std::string const& buffer)
+            : buffer_reader(buffer.data(), buffer.size())
+        { }
+
+        bool read(char* data, std::size_t size) {
+            if (size > remaining())
+                return false;
+            std::memcpy(data, first_, size);
+            first_ += size;
+            return true;
+        }
+
+        std::size_t remaining() const
+        { return static_cast<std::size_t>(last_ - first_); }
+    };
+
+    namespace serialize_detail {
+        template <typename T, bool = hana::Struct<T>::value &&
+                                     std::is_trivially_copyable<T>::value>
+        struct is_dense_struct;
+
+        // Whether objects of type `T` are written as their object
+        // representation. `bool`s and enumerations are not, since not all
+        // the bytes that could be read back form valid values of these types,
+        // and neither are the types handled by another model (whose tag may
+        // be incomplete), unless they are `Struct`s whose members are
+        // contiguous and written as is.
+        template <typename T, bool = std::is_same<T, bool>::value ||
+                                     std::is_enum<T>::value ||
+                                     !std::is_same<typename hana::tag_of<T>::type, T>::value ||
+                                     hana::Constant<T>::value ||
+                                     hana::Sequence<T>::value ||
+                                     hana::Product<T>::value>
+        struct is_bitwise : std::false_type { };
+
+        template <typename T>
+        struct is_bitwise<T, false>
+            : std::integral_constant<bool,
+                std::is_trivially_copyable<T>::value &&
+                (!hana::Struct<T>::value || is_dense_struct<T>::value)
+            >
+        { };
+
+        template <typename Writer>
+        class output {
+            Writer& writer_;
+
+        public:
+            explicit output(Writer& writer) : writer_(writer) { }
+
+            void write(void const* data, std::size_t size) {
+                if (size != 0)
+                    writer_.write(static_cast<char const*>(data), size);
+            }
+        };
+
+        template <typename Reader, typename = void>
+        struct knows_remaining : std::false_type { };
+
+        template <typename Reader>
+        struct knows_remaining<Reader, decltype(
+            (void)std::declval<Reader const&>().remaining()
+        )> : std::true_type { };
+
+        // Same as `output`, but for filling the representation of an object
+        // from a reader. Once a read has failed, nothing else is read.
+        template <typename Reader>
+        class input {
+            Reader& reader_;
+            bool good_ = true;
+
+            template <typename R>
+            static std::size_t remaining_in(R const& reader, std::true_type)
+            { return static_cast<std::size_t>(reader.remaining()); }
+
+            template <typename R>
+            static std::size_t remaining_in(R const&, std::false_type)
+            { return std::numeric_limits<std::size_t>::max(); }
+
+        public:
+            static constexpr bool knows_remaining =
+                serialize_detail::knows_remaining<Reader>::value;
+
+            explicit input(Reader& reader) : reader_(reader) { }
+
+            bool good() const { return good_; }
+
+            void fail() { good_ = false; }
+
+            // The number of bytes left in the reader, or the maximum value
+            // of `std::size_t` when the reader can't tell.
+            std::size_t remaining() const {
+                return good_ ? remaining_in(reader_, serialize_detail::knows_remaining<Reader>{}) : 0;
+            }
+
+            void read(void* data, std::size_t size) {
+                if (good_ && size != 0)
+                    good_ = static_cast<bool>(reader_.read(static_cast<char*>(data), size));
+            }
+        };
+
+        template <typename Reader>
+        constexpr bool input<Reader>::knows_remaining;
+
+        template <typename Output, typename T>
+        void save(Output& out, T const& t) {
+            using Tag = typename hana::tag_of<T>::type;
+            serialize_impl<Tag>::save(out, t);
+        }
+
+        template <typename Input, typename T>
+        void load(Input& in, T& t) {
+            using Tag = typename hana::tag_of<T>::type;
+            serialize_impl<Tag>::load(in, t);
+        }
+
+        template <typename Output>
+        struct save_each {
+            Output& out;
+
+            template <typename ...X>
+            void operator()(X const& ...x) const {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)serialize_detail::save(out, x), 0)...};
+                (void)out; // unused when there are no elements
+            }
+        };
+
+        template <typename Input>
+        struct load_each {
+            Input& in;
+
+            template <typename ...X>
+            void operator()(X& ...x) const {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)serialize_detail::load(in, x), 0)...};
+                (void)in; // unused when there are no elements
+            }
+        };
+
+        template <typename Members>
+        struct holds_mutable_references;
+
+        template <typename ...T>
+        struct holds_mutable_references<hana::tuple<T...>>
+            : detail::fast_and<(
+                std::is_lvalue_reference<T>::value &&
+                !std::is_const<typename std::remove_reference<T>::type>::value
+            )...>
+        { };
+
+        // The type of the member designated by an accessor, or `void` when
+        // the accessor is not a pointer to a member.
+        template <typename Accessor>
+        struct member_type {
+            using type = void;
+        };
+
+        template <typename Name, typename M, typename C, M C::* ptr>
+        struct member_type<hana::pair<Name, struct_detail::member_ptr<M C::*, ptr>>> {
+            using type = M;
+        };
+
+        template <typename M>
+        struct member_info {
+            static constexpr bool bitwise = is_bitwise<M>::value;
+            static constexpr std::size_t size = sizeof(M);
+            static constexpr std::size_t align = alignof(M);
+        };
+
+        template <>
+        struct member_info<void> {
+            static constexpr bool bitwise = false;
+            static constexpr std::size_t size = 0;
+            static constexpr std::size_t align = 1;
+        };
+
+        template <std::size_t N>
+        struct member_runs {
+            // The number of bytes written at once from each member that
+            // starts a run, which is 0 for members written on their own.
+            detail::array<std::size_t, N> bytes;
+            // Whether each member is written by the run of a previous member.
+            detail::array<bool, N> covered;
+        };
+
+        // Groups the consecutive members of a `Struct` that are written as
+        // is into runs. The members of a `Struct` defined with
+        // `BOOST_HANA_DEFINE_STRUCT` are declared one after the other in
+        // the order of its accessors, so a member immediately follows the
+        // previous one unless its alignment requires padding. Since a run
+        // starts at a multiple of the alignment of its first member, this is
+        // known at compile-time for the members whose alignment is at most
+        // that one. Other runs are split, and so are the members of `Struct`s
+        // whose accessors may not follow the order of their declaration.
+        //
+        // When the sizes of all the members add up to the size of the
+        // `Struct`, there is no padding nor any other member, and the whole
+        // object is a single run.
+        template <typename S, bool Declared, typename ...M>
+        struct struct_layout {
+            static constexpr std::size_t N = sizeof...(M);
+
+            static constexpr std::size_t total_size() {
+                constexpr std::size_t size[] = {member_info<M>::size..., 0};
+                std::size_t total = 0;
+                for (std::size_t k = 0; k < N; ++k)
+                    total += size[k];
+                return total;
+            }
+
+            static constexpr bool dense = Declared && N != 0 &&
+                detail::fast_and<member_info<M>::bitwise...>::value &&
+                total_size() == sizeof(S);
+
+            static constexpr member_runs<N> compute_runs() {
+                constexpr bool bitwise[] = {member_info<M>::bitwise..., false};
+                constexpr std::size_t size[] = {member_info<M>::size..., 0};
+                constexpr std::size_t align[] = {member_info<M>::align..., 1};
+                member_runs<N> runs{};
+                if (dense) {
+                    runs.bytes[0] = sizeof(S);
+                    for (std::size_t k = 1; k < N; ++k)
+                        runs.covered[k] = true;
+                    return runs;
+                }
+                for (std::size_t k = 0; k < N; ) {
+                    if (!bitwise[k]) {
+                        ++k;
+                        continue;
+                    }
+                    std::size_t first = k;
+                    std::size_t bytes = size[k];
+                    for (++k; Declared && k < N && bitwise[k] &&
+                              align[first] % align[k] == 0 &&
+                              bytes % align[k] == 0; ++k) {
+                        runs.covered[k] = true;
+                        bytes += size[k];
+                    }
+                    runs.bytes[first] = bytes;
+                }
+                return runs;
+            }
+
+            static constexpr member_runs<N> runs = compute_runs();
+        };
+
+        template <typename S, typename = void>
+        struct has_declared_members : std::false_type { };
+
+        template <typename S>
+        struct has_declared_members<S, decltype((void)sizeof(typename S::hana_accessors_impl))>
+            : std::true_type
+        { };
+
+        template <typename S>
+        struct make_struct_layout {
+            template <typename ...Accessor>
+            constexpr auto operator()(Accessor&& ...) const -> struct_layout<
+                S, has_declared_members<S>::value,
+                typename member_type<typename detail::decay<Accessor>::type>::type...
+            > { return {}; }
+        };
+
+        template <typename S>
+        using layout_of = decltype(hana::unpack(hana::accessors<S>(),
+                                                make_struct_layout<S>{}));
+
+        template <typename T, bool>
+        struct is_dense_struct : std::false_type { };
+
+        template <typename T>
+        struct is_dense_struct<T, true>
+            : std::integral_constant<bool, layout_of<T>::dense>
+        { };
+
+        template <typename Output, typename X, std::size_t bytes>
+        void save_member(Output& out, X const& x, hana::size_t<bytes>, hana::false_)
+        { out.write(std::addressof(x), bytes); }
+
+        template <typename Output, typename X>
+        void save_member(Output& out, X const& x, hana::size_t<0>, hana::false_)
+        { serialize_detail::save(out, x); }
+
+        template <typename Output, typename X, std::size_t bytes>
+        void save_member(Output&, X const&, hana::size_t<bytes>, hana::true_)
+        { }
+
+        template <typename Input, typename X, std::size_t bytes>
+        void load_member(Input& in, X& x, hana::size_t<bytes>, hana::false_)
+        { in.read(std::addressof(x), bytes); }
+
+        template <typename Input, typename X>
+        void load_member(Input& in, X& x, hana::size_t<0>, hana::false_)
+        { serialize_detail::load(in, x); }
+
+        template <typename Input, typename X, std::size_t bytes>
+        void load_member(Input&, X&, hana::size_t<bytes>, hana::true_)
+        { }
+
+        template <typename Layout, typename Output, typename Members, std::size_t ...k>
+        void save_members(Output& out, Members const& members, std::index_sequence<k...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)serialize_detail::save_member(out,
+                hana::at_c<k>(members),
+                hana::size_c<Layout::runs.bytes[k]>,
+                hana::bool_c<Layout::runs.covered[k]>), 0)...};
+            (void)out; // unused when there are no members
+        }
+
+        template <typename Layout, typename Input, typename Members, std::size_t ...k>
+        void load_members(Input& in, Members& members, std::index_sequence<k...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)serialize_detail::load_member(in,
+                hana::at_c<k>(members),
+                hana::size_c<Layout::runs.bytes[k]>,
+                hana::bool_c<Layout::runs.covered[k]>), 0)...};
+            (void)in; // unused when there are no members
+        }
+
+        template <typename Output, typename T>
+        void save_range(Output& out, T const* data, std::size_t size, std::true_type) {
+            out.write(data, size * sizeof(T));
+        }
+
+        template <typename Output, typename T>
+        void save_range(Output& out, T const* data, std::size_t size, std::false_type) {
+            for (std::size_t i = 0; i != size; ++i)
+                serialize_detail::save(out, data[i]);
+        }
+
+        template <typename Input, typename T>
+        void load_range(Input& in, T* data, std::size_t size, std::true_type) {
+            in.read(data, size * sizeof(T));
+        }
+
+        template <typename Input, typename T>
+        void load_range(Input& in, T* data, std::size_t size, std::false_type) {
+            for (std::size_t i = 0; i != size; ++i)
+                serialize_detail::load(in, data[i]);
+        }
+
+        template <typename Output>
+        void save_size(Output& out, std::size_t size) {
+            std::uint64_t n = size;
+            out.write(&n, sizeof n);
+        }
+
+        template <typename Input>
+        std::size_t load_size(Input& in) {
+            std::uint64_t n = 0;
+            in.read(&n, sizeof n);
+            if (n > std::numeric_limits<std::size_t>::max())
+                in.fail();
+            return in.good() ? static_cast<std::size_t>(n) : 0;
+        }
+
+        // Resizes a container to the `size` read from the input, and loads
+        // its elements with `load(first, count)`. Since `size` can not be
+        // trusted, it is rejected right away if the elements are known to
+        // take `bytes` bytes each and the reader does not have that many
+        // bytes left. Otherwise, the container is grown as its elements are
+        // read, so that memory is only allocated for elements actually
+        // present in the input.
+        template <typename Input, typename Container, typename Load>
+        void load_elements(Input& in, Container& c, std::size_t size,
+                           std::size_t bytes, Load load)
+        {
+            c.clear();
+            if (bytes != 0 && size > in.remaining() / bytes) {
+                in.fail();
+                return;
+            }
+
+            std::size_t batch = bytes != 0 && Input::knows_remaining ? size : 64;
+            for (std::size_t first = 0; first != size && in.good(); ) {
+                std::size_t count = std::min(size - first, std::max(first, batch));
+                c.resize(first + count);
+                load(first, count);
+                first += count;
+            }
+        }
+    }
+
+    //! @cond
+    template <typename Writer, typename T>
+    void serialize_t::operator()(Writer& writer, T const& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using Serialize = BOOST_HANA_DISPATCH_IF(serialize_impl<Tag>,
+            hana::experimental::Serializable<Tag>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::experimental::Serializable<Tag>::value,
+        "hana::experimental::serialize(writer, t) requires 't' to be Serializable");
+    #endif
+
+        serialize_detail::output<Writer> out{writer};
+        Serialize::save(out, t);
+    }
+
+    template <typename T>
+    std::string serialize_t::operator()(T const& t) const {
+        std::string buffer;
+        string_writer writer{buffer};
+        (*this)(writer, t);
+        return buffer;
+    }
+
+    template <typename Reader, typename T>
+    bool deserialize_t::operator()(Reader& reader, T& t) const {
+        using Tag = typename hana::tag_of<T>::type;
+        using Deserialize = BOOST_HANA_DISPATCH_IF(serialize_impl<Tag>,
+            hana::experimental::Serializable<Tag>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::experimental::Serializable<Tag>::value,
+        "hana::experimental::deserialize(reader, t) requires 't' to be Serializable");
+    #endif
+
+        serialize_detail::input<Reader> in{reader};
+        Deserialize::load(in, t);
+        return in.good();
+    }
+    //! @endcond
+
+    // model for types written as is, except Structs
+    template <typename T>
+    struct serialize_impl<T, hana::when<
+        serialize_detail::is_bitwise<T>::value && !hana::Struct<T>::value
+    >> {
+        template <typename Output>
+        static void save(Output& out, T const& t)
+        { out.write(std::addressof(t), sizeof t); }
+
+        template <typename Input>
+        static void load(Input& in, T& t)
+        { in.read(std::addressof(t), sizeof t); }
+    };
+
+    // model for bools, which are rejected unless they are 0 or 1
+    template <>
+    struct serialize_impl<bool> {
+        template <typename Output>
+        static void save(Output& out, bool t) {
+            unsigned char byte = t ? 1 : 0;
+            out.write(&byte, sizeof byte);
+        }
+
+        template <typename Input>
+        static void load(Input& in, bool& t) {
+            unsigned char byte = 0;
+            in.read(&byte, sizeof byte);
+            if (byte > 1)
+                in.fail();
+            else if (in.good())
+                t = byte != 0;
+        }
+    };
+
+    // model for enumerations
+    template <typename E>
+    struct serialize_impl<E, hana::when<std::is_enum<E>::value>> {
+        using U = typename std::underlying_type<E>::type;
+
+        template <typename Output>
+        static void save(Output& out, E t) {
+            U u = static_cast<U>(t);
+            out.write(&u, sizeof u);
+        }
+
+        template <typename Input>
+        static void load(Input& in, E& t) {
+            U u{};
+            in.read(&u, sizeof u);
+            if (in.good())
+                t = static_cast<E>(u);
+        }
+    };
+
+    // model for Constants, whose value is known from their type
+    template <typename C>
+    struct serialize_impl<C, hana::when<hana::Constant<C>::value>> {
+        template <typename Output, typename T>
+        static void save(Output&, T const&) { }
+
+        template <typename Input, typename T>
+        static void load(Input&, T&) { }
+    };
+
+    // model for Structs
+    template <typename S>
+    struct serialize_impl<S, hana::when<hana::Struct<S>::value>> {
+        using Layout = serialize_detail::layout_of<S>;
+
+        template <typename Output, typename T>
+        static void save(Output& out, T const& t) {
+            auto&& members = hana::forward_members(t);
+            serialize_detail::save_members<Layout>(out, members,
+                std::make_index_sequence<Layout::N>{});
+        }
+
+        template <typename Input, typename T>
+        static void load(Input& in, T& t) {
+            auto&& members = hana::forward_members(t);
+            using Members = typename std::remove_reference<decltype(members)>::type;
+            static_assert(serialize_detail::holds_mutable_references<Members>::value,
+            "hana::experimental::deserialize(reader, t) requires the accessors "
+            "of the Struct 't' to return references to its members");
+            serialize_detail::load_members<Layout>(in, members,
+                std::make_index_sequence<Layout::N>{});
+        }
+    };
+
+    // model for Sequences
+    template <typename S>
+    struct serialize_impl<S, hana::when<hana::Sequence<S>::value>> {
+        template <typename Output, typename Xs>
+        static void save(Output& out, Xs const& xs)
+        { hana::unpack(xs, serialize_detail::save_each<Output>{out}); }
+
+        template <typename Input, typename Xs>
+        static void load(Input& in, Xs& xs)
+        { hana::unpack(xs, serialize_detail::load_each<Input>{in}); }
+    };
+
+    // model for Products
+    template <typename P>
+    struct serialize_impl<P, hana::when<hana::Product<P>::value>> {
+        template <typename Output, typename T>
+        static void save(Output& out, T const& t) {
+            serialize_detail::save_each<Output>{out}(hana::first(t), hana::second(t));
+        }
+
+        template <typename Input, typename T>
+        static void load(Input& in, T& t) {
+            serialize_detail::load_each<Input>{in}(hana::first(t), hana::second(t));
+        }
+    };
+
+    // model for hana::maps
+    template <>
+    struct serialize_impl<hana::map_tag> {
+        template <typename Output, typename M>
+        static void save(Output& out, M const& map) {
+            hana::unpack(map, [&out](auto const& ...pair) {
+                serialize_detail::save_each<Output>{out}(hana::second(pair)...);
+            });
+        }
+
+        template <typename Input, typename M>
+        static void load(Input& in, M& map) {
+            hana::unpack(map, [&in](auto& ...pair) {
+                serialize_detail::load_each<Input>{in}(hana::second(pair)...);
+            });
+        }
+    };
+
+    // model for std::arrays
+    template <>
+    struct serialize_impl<hana::ext::std::array_tag> {
+        template <typename Output, typename T, std::size_t N>
+        static void save(Output& out, std::array<T, N> const& a) {
+            serialize_detail::save_range(out, a.data(), N,
+                serialize_detail::is_bitwise<T>{});
+        }
+
+        template <typename Input, typename T, std::size_t N>
+        static void load(Input& in, std::array<T, N>& a) {
+            serialize_detail::load_range(in, a.data(), N,
+                serialize_detail::is_bitwise<T>{});
+        }
+    };
+
+    // model for std::vectors
+    template <>
+    struct serialize_impl<hana::ext::std::vector_tag> {
+        template <typename Output, typename T, typename Allocator>
+        static void save(Output& out, std::vector<T, Allocator> const& v) {
+            serialize_detail::save_size(out, v.size());
+            serialize_detail::save_range(out, v.data(), v.size(),
+                serialize_detail::is_bitwise<T>{});
+        }
+
+        template <typename Input, typename T, typename Allocator>
+        static void load(Input& in, std::vector<T, Allocator>& v) {
+            using Bitwise = serialize_detail::is_bitwise<T>;
+            serialize_detail::load_elements(in, v, serialize_detail::load_size(in),
+                                            Bitwise::value ? sizeof(T) : 0,
+            [&in, &v](std::size_t first, std::size_t count) {
+                serialize_detail::load_range(in, v.data() + first, count, Bitwise{});
+            });
+        }
+
+        // std::vector<bool> does not store actual bools, so they are
+        // written one at a time.
+        template <typename Output, typename Allocator>
+        static void save(Output& out, std::vector<bool, Allocator> const& v) {
+            serialize_detail::save_size(out, v.size());
+            for (bool x : v)
+                serialize_impl<bool>::save(out, x);
+        }
+
+        template <typename Input, typename Allocator>
+        static void load(Input& in, std::vector<bool, Allocator>& v) {
+            serialize_detail::load_elements(in, v, serialize_detail::load_size(in), 1,
+            [&in, &v](std::size_t first, std::size_t count) {
+                for (std::size_t i = first; i != first + count; ++i) {
+                    bool x = false;
+                    serialize_impl<bool>::load(in, x);
+                    v[i] = x;
+                }
+            });
+        }
+    };
+
+    // model for std::basic_strings
+    template <typename Char, typename Traits, typename Allocator>
+    struct serialize_impl<std::basic_string<Char, Traits, Allocator>> {
+        template <typename Output>
+        static void save(Output& out, std::basic_string<Char, Traits, Allocator> const& s) {
+            serialize_detail::save_size(out, s.size());
+            out.write(s.data(), s.size() * sizeof(Char));
+        }
+
+        template <typename Input>
+        static void load(Input& in, std::basic_string<Char, Traits, Allocator>& s) {
+            serialize_detail::load_elements(in, s, serialize_detail::load_size(in),
+                                            sizeof(Char),
+            [&in, &s](std::size_t first, std::size_t count) {
+                in.read(&s[first], count * sizeof(Char));
+            });
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
@@ -0,0 +1,562 @@
+/*!
+@file
+Defines `boost::hana::experimental::soa_vector`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+#define BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/forward_members.hpp>
+#include <boost/hana/fwd/accessors.hpp>
+#include <boost/hana/index_if.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        template <typename S>
+        class soa_vector;
+
+        template <typename S>
+        struct soa_reference_tag;
+
+        namespace soa_detail {
+            // Column of the values of a `bool` member. `std::vector<bool>`
+            // packs its values into bits, so they could not be accessed as
+            // a contiguous array like the values of the other members.
+            class bool_column {
+                std::unique_ptr<bool[]> data_;
+                std::size_t size_ = 0;
+                std::size_t capacity_ = 0;
+
+            public:
+                using value_type = bool;
+
+                bool_column() = default;
+
+                bool_column(bool_column&& other) noexcept
+                    : data_{std::move(other.data_)}
+                    , size_{other.size_}, capacity_{other.capacity_}
+                { other.size_ = other.capacity_ = 0; }
+
+                bool_column& operator=(bool_column&& other) noexcept {
+                    data_ = std::move(other.data_);
+                    size_ = other.size_;
+                    capacity_ = other.capacity_;
+                    other.size_ = other.capacity_ = 0;
+                    return *this;
+                }
+
+                bool_column(bool_column const& other) {
+                    reserve(other.size_);
+                    std::copy(other.data(), other.data() + other.size_, data());
+                    size_ = other.size_;
+                }
+
+                bool_column& operator=(bool_column const& other) {
+                    if (this != &other)
+                        *this = bool_column{other};
+                    return *this;
+                }
+
+                bool* data() noexcept { return data_.get(); }
+                bool const* data() const noexcept { return data_.get(); }
+                std::size_t size() const noexcept { return size_; }
+
+                bool& operator[](std::size_t n) { return data_[n]; }
+                bool const& operator[](std::size_t n) const { return data_[n]; }
+
+                void reserve(std::size_t n) {
+                    if (n <= capacity_)
+                        return;
+                    std::unique_ptr<bool[]> data{new bool[n]};
+                    std::copy(this->data(), this->data() + size_, data.get());
+                    data_ = std::move(data);
+                    capacity_ = n;
+                }
+
+                void resize(std::size_t n) {
+                    if (n > size_) {
+                        reserve(n);
+                        std::fill(data() + size_, data() + n, false);
+                    }
+                    size_ = n;
+                }
+
+                void push_back(bool b) {
+                    if (size_ == capacity_)
+                        reserve(capacity_ == 0 ? 1 : 2 * capacity_);
+                    data_[size_++] = b;
+                }
+
+                template <typename Arg>
+                void emplace_back(Arg&& arg)
+                { push_back(static_cast<bool>(static_cast<Arg&&>(arg))); }
+
+                void pop_back() noexcept { --size_; }
+                void clear() noexcept { size_ = 0; }
+            };
+
+            template <typename T>
+            struct column { using type = std::vector<T>; };
+
+            template <>
+            struct column<bool> { using type = bool_column; };
+
+            template <typename Members>
+            struct columns;
+
+            template <typename ...T>
+            struct columns<hana::tuple<T...>> {
+                using type = hana::tuple<
+                    typename column<typename std::decay<T>::type>::type...
+                >;
+            };
+
+            template <typename Key>
+            struct has_key {
+                template <typename Accessor>
+                auto operator()(Accessor const& accessor) const -> decltype(
+                    hana::equal(std::declval<Key const&>(), hana::first(accessor))
+                );
+            };
+
+            // Looks the key up in the `member_table` of `S` when possible,
+            // like `hana::find` does, and compares it with the key of each
+            // member otherwise.
+            template <typename S, typename Key,
+                bool = struct_detail::has_member_table<S, Key>::value>
+            struct find_member_index {
+                using type = typename struct_detail::find_member_index<S, Key>::type;
+            };
+
+            template <typename S, typename Key>
+            struct find_member_index<S, Key, false> {
+                using type = decltype(hana::index_if(
+                    hana::accessors<S>(), has_key<Key>{}
+                ));
+            };
+
+            // The index of the member of `S` with the given key.
+            template <typename S, typename Key>
+            struct member_index {
+                using MaybeIndex = typename find_member_index<S, Key>::type;
+
+                static_assert(!std::is_same<MaybeIndex, hana::optional<>>::value,
+                "hana::experimental::soa_vector: the given key is not the name "
+                "of a member of the Struct");
+
+                static constexpr std::size_t value =
+                    std::decay<decltype(std::declval<MaybeIndex>().value())>::type::value;
+            };
+
+            //! @ingroup group-experimental
+            //! Contiguous range of the values of one member of the elements
+            //! of a `soa_vector`.
+            template <typename T>
+            struct span {
+                T* first;
+                T* last;
+
+                constexpr T* begin() const { return first; }
+                constexpr T* end() const { return last; }
+                constexpr T* data() const { return first; }
+                constexpr std::size_t size() const
+                { return static_cast<std::size_t>(last - first); }
+                constexpr bool empty() const { return first == last; }
+                constexpr T& operator[](std::size_t n) const { return first[n]; }
+            };
+
+            template <typename S, typename Columns, std::size_t ...i>
+            S make_struct(Columns& columns, std::size_t n, std::index_sequence<i...>) {
+                S s{};
+                auto members = hana::forward_members(s);
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    hana::at_c<i>(members) = hana::at_c<i>(columns)[n]
+                ), 0)...};
+                return s;
+            }
+
+            template <typename Columns, typename Members, std::size_t ...i>
+            void assign(Columns& columns, std::size_t n, Members&& members,
+                        std::index_sequence<i...>)
+            {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    hana::at_c<i>(columns)[n] =
+                        hana::at_c<i>(static_cast<Members&&>(members))
+                ), 0)...};
+            }
+
+            //! @ingroup group-experimental
+            //! Proxy standing for an element of a `soa_vector`.
+            //!
+            //! A `soa_reference` refers to the members of an element of a
+            //! `soa_vector`, which are stored in different arrays. It is a
+            //! `Struct` with the same keys as `S`, whose members are those
+            //! of the referred-to element. It can also be converted to an
+            //! `S`, and assigning an `S` to it assigns the members of the
+            //! referred-to element. Like other proxies, the constness of
+            //! a `soa_reference` does not affect the referred-to element.
+            template <typename S, typename Columns>
+            class soa_reference {
+                static constexpr std::size_t N = std::decay<
+                    decltype(hana::length(std::declval<Columns&>()))
+                >::type::value;
+                using Indices = std::make_index_sequence<N>;
+
+                Columns* columns_;
+                std::size_t index_;
+
+            public:
+                using hana_tag = soa_reference_tag<S>;
+
+                constexpr soa_reference(Columns* columns, std::size_t index)
+                    : columns_{columns}, index_{index}
+                { }
+
+                soa_reference(soa_reference const&) = default;
+
+                // Assigning a reference to another one assigns the elements
+                // they refer to, like for `std::vector<bool>::reference`.
+                soa_reference const& operator=(soa_reference const& other) const {
+                    *this = static_cast<S>(other);
+                    return *this;
+                }
+
+                soa_reference const& operator=(S const& s) const {
+                    soa_detail::assign(*columns_, index_,
+                                       hana::forward_members(s), Indices{});
+                    return *this;
+                }
+
+                soa_reference const& operator=(S&& s) const {
+                    soa_detail::assign(*columns_, index_,
+                                       hana::forward_members(static_cast<S&&>(s)),
+                                       Indices{});
+                    return *this;
+                }
+
+                operator S() const
+                { return soa_detail::make_struct<S>(*columns_, index_, Indices{}); }
+
+                //! Returns a reference to the `n`th member of the element.
+                template <std::size_t n>
+                constexpr decltype(auto) get() const
+                { return hana::at_c<n>(*columns_)[index_]; }
+
+                //! Returns a reference to the member of the element with the
+                //! given key.
+                template <typename Key>
+                constexpr decltype(auto) operator[](Key const&) const
+                { return get<soa_detail::member_index<S, Key>::value>(); }
+            };
+
+            template <std::size_t n>
+            struct get_member {
+                template <typename Reference>
+                constexpr decltype(auto) operator()(Reference const& ref) const
+                { return ref.template get<n>(); }
+            };
+
+            template <typename S, typename Columns>
+            class soa_iterator {
+                Columns* columns_;
+                std::size_t index_;
+
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = S;
+                using difference_type = std::ptrdiff_t;
+                using reference = soa_reference<S, Columns>;
+                using pointer = void;
+
+                constexpr soa_iterator() : columns_{nullptr}, index_{0} { }
+
+                constexpr soa_iterator(Columns* columns, std::size_t index)
+                    : columns_{columns}, index_{index}
+                { }
+
+                // Allows converting an iterator to a const_iterator.
+                template <typename Other, typename = typename std::enable_if<
+                    std::is_same<Other const, Columns>::value &&
+                    !std::is_same<Other, Columns>::value
+                >::type>
+                constexpr soa_iterator(soa_iterator<S, Other> const& other)
+                    : columns_{other.columns()}, index_{other.index()}
+                { }
+
+                constexpr Columns* columns() const { return columns_; }
+                constexpr std::size_t index() const { return index_; }
+
+                constexpr reference operator*() const { return {columns_, index_}; }
+                constexpr reference operator[](difference_type n) const
+                { return {columns_, index_ + n}; }
+
+                soa_iterator& operator++() { ++index_; return *this; }
+                soa_iterator& operator--() { --index_; return *this; }
+                soa_iterator operator++(int) { soa_iterator it = *this; ++index_; return it; }
+                soa_iterator operator--(int) { soa_iterator it = *this; --index_; return it; }
+                soa_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+                soa_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+                friend constexpr soa_iterator operator+(soa_iterator it, difference_type n)
+                { return {it.columns_, it.index_ + n}; }
+                friend constexpr soa_iterator operator+(difference_type n, soa_iterator it)
+                { return {it.columns_, it.index_ + n}; }
+                friend constexpr soa_iterator operator-(soa_iterator it, difference_type n)
+                { return {it.columns_, it.index_ - n}; }
+                friend constexpr difference_type operator-(soa_iterator a, soa_iterator b)
+                { return static_cast<difference_type>(a.index_ - b.index_); }
+
+                friend constexpr bool operator==(soa_iterator a, soa_iterator b)
+                { return a.index_ == b.index_; }
+                friend constexpr bool operator!=(soa_iterator a, soa_iterator b)
+                { return a.index_ != b.index_; }
+                friend constexpr bool operator<(soa_iterator a, soa_iterator b)
+                { return a.index_ < b.index_; }
+                friend constexpr bool operator>(soa_iterator a, soa_iterator b)
+                { return a.index_ > b.index_; }
+                friend constexpr bool operator<=(soa_iterator a, soa_iterator b)
+                { return a.index_ <= b.index_; }
+                friend constexpr bool operator>=(soa_iterator a, soa_iterator b)
+                { return a.index_ >= b.index_; }
+            };
+        }
+
+        //! @ingroup group-experimental
+        //! Sequence of `Struct`s stored as one contiguous array per member.
+        //!
+        //! `soa_vector<S>` holds a sequence of objects of type `S`, like
+        //! `std::vector<S>`. However, instead of storing the objects one
+        //! after the other, it stores the values of each member of `S`
+        //! in a different `std::vector`. This "struct of arrays" layout
+        //! makes scanning a few members of all the objects much cheaper,
+        //! since the other members are not loaded in the cache.
+        //!
+        //! `S` must be a default-constructible `Struct` whose accessors
+        //! return references to its members, which is the case for the
+        //! accessors created by `BOOST_HANA_DEFINE_STRUCT` and
+        //! `BOOST_HANA_ADAPT_STRUCT`. The elements are accessed through
+        //! `soa_reference` proxies, and the values of a single member can
+        //! be accessed as a contiguous range with `span(key)`, where `key`
+        //! is the key of that member in the `accessors` of `S`.
+        //!
+        //! Each member is stored in a `std::vector`, except for members of
+        //! type `bool`, which are stored in an array of `bool`s rather than in
+        //! a `std::vector<bool>`, so `span` can be used with them too.
+        //!
+        //! If copying, moving or constructing a member throws while elements
+        //! are added by `push_back`, `emplace_back` or `resize`, the values
+        //! that were already added to some of the columns are removed, so the
+        //! `soa_vector` is left unchanged.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @include example/experimental/soa_vector.cpp
+        template <typename S>
+        class soa_vector {
+            static_assert(hana::Struct<S>::value,
+            "hana::experimental::soa_vector<S> requires 'S' to be a Struct");
+
+            using Columns = typename soa_detail::columns<
+                decltype(hana::forward_members(std::declval<S&>()))
+            >::type;
+
+            static constexpr std::size_t N = std::decay<
+                decltype(hana::length(std::declval<Columns&>()))
+            >::type::value;
+            using Indices = std::make_index_sequence<N>;
+
+            Columns columns_;
+            std::size_t size_ = 0;
+
+            template <typename F, std::size_t ...i>
+            void for_each_column(F f, std::index_sequence<i...>) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)f(hana::at_c<i>(columns_)), 0)...};
+                (void)f; // unused when S has no members
+            }
+
+            template <typename F>
+            void for_each_column(F f)
+            { for_each_column(f, Indices{}); }
+
+            // Removes the values that were added to some of the columns
+            // before one of them threw.
+            void rollback() noexcept {
+                std::size_t const n = size_;
+                for_each_column([n](auto& column) {
+                    while (column.size() > n)
+                        column.pop_back();
+                });
+            }
+
+            // Calls `f`, which adds values to the columns, and rolls these
+            // additions back if it throws.
+            template <typename F>
+            void with_rollback(F f) {
+            #ifdef BOOST_HANA_CONFIG_HAS_EXCEPTIONS
+                try {
+                    f();
+                } catch (...) {
+                    rollback();
+                    throw;
+                }
+            #else
+                f();
+            #endif
+            }
+
+            template <typename Members, std::size_t ...i>
+            void append(Members&& members, std::index_sequence<i...>) {
+                with_rollback([&] {
+                    using Swallow = int[];
+                    (void)Swallow{0, ((void)hana::at_c<i>(columns_).push_back(
+                        hana::at_c<i>(static_cast<Members&&>(members))
+                    ), 0)...};
+                });
+                ++size_;
+            }
+
+            template <typename ...Args, std::size_t ...i>
+            void append_in_place(std::index_sequence<i...>, Args&& ...args) {
+                with_rollback([&] {
+                    using Swallow = int[];
+                    (void)Swallow{0, ((void)hana::at_c<i>(columns_).emplace_back(
+                        static_cast<Args&&>(args)
+                    ), 0)...};
+                });
+                ++size_;
+            }
+
+        public:
+            using value_type = S;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = soa_detail::soa_reference<S, Columns>;
+            using const_reference = soa_detail::soa_reference<S, Columns const>;
+            using iterator = soa_detail::soa_iterator<S, Columns>;
+            using const_iterator = soa_detail::soa_iterator<S, Columns const>;
+
+            soa_vector() = default;
+
+            std::size_t size() const noexcept { return size_; }
+            bool empty() const noexcept { return size_ == 0; }
+
+            void reserve(std::size_t n) {
+                for_each_column([n](auto& column) { column.reserve(n); });
+            }
+
+            void resize(std::size_t n) {
+                with_rollback([this, n] {
+                    for_each_column([n](auto& column) { column.resize(n); });
+                });
+                size_ = n;
+            }
+
+            void clear() noexcept {
+                for_each_column([](auto& column) { column.clear(); });
+                size_ = 0;
+            }
+
+            void push_back(S const& s)
+            { append(hana::forward_members(s), Indices{}); }
+
+            void push_back(S&& s)
+            { append(hana::forward_members(static_cast<S&&>(s)), Indices{}); }
+
+            //! Adds an element whose members are constructed in place from
+            //! the given arguments, one argument per member.
+            template <typename ...Args>
+            reference emplace_back(Args&& ...args) {
+                static_assert(sizeof...(Args) == N,
+                "hana::experimental::soa_vector::emplace_back(args...) requires "
+                "exactly one argument per member");
+                append_in_place(Indices{}, static_cast<Args&&>(args)...);
+                return back();
+            }
+
+            void pop_back() {
+                for_each_column([](auto& column) { column.pop_back(); });
+                --size_;
+            }
+
+            reference operator[](std::size_t n) { return {&columns_, n}; }
+            const_reference operator[](std::size_t n) const { return {&columns_, n}; }
+
+            reference front() { return (*this)[0]; }
+            const_reference front() const { return (*this)[0]; }
+            reference back() { return (*this)[size_ - 1]; }
+            const_reference back() const { return (*this)[size_ - 1]; }
+
+            iterator begin() { return {&columns_, 0}; }
+            iterator end() { return {&columns_, size_}; }
+            const_iterator begin() const { return {&columns_, 0}; }
+            const_iterator end() const { return {&columns_, size_}; }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            //! Returns the contiguous range of the values of the member with
+            //! the given key.
+            template <typename Key>
+            auto span(Key const&) {
+                auto& column = hana::at_c<soa_detail::member_index<S, Key>::value>(columns_);
+                using T = typename std::remove_reference<decltype(column)>::type::value_type;
+                return soa_detail::span<T>{column.data(), column.data() + size_};
+            }
+
+            template <typename Key>
+            auto span(Key const&) const {
+                auto& column = hana::at_c<soa_detail::member_index<S, Key>::value>(columns_);
+                using T = typename std::remove_reference<decltype(column)>::type::value_type;
+                return soa_detail::span<T const>{column.data(), column.data() + size_};
+            }
+        };
+    } // end namespace experimental
+
+    // A `soa_reference` is a `Struct` with the same keys as `S`.
+    template <typename S>
+    struct accessors_impl<experimental::soa_reference_tag<S>> {
+        template <std::size_t ...i>
+        static constexpr auto apply_impl(std::index_sequence<i...>) {
+            return hana::make_tuple(
+                hana::make_pair(hana::first(hana::at_c<i>(hana::accessors<S>())),
+                                experimental::soa_detail::get_member<i>{})...
+            );
+        }
+
+        static constexpr auto apply() {
+            return apply_impl(std::make_index_sequence<
+                decltype(hana::length(hana::accessors<S>()))::value
+            >{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
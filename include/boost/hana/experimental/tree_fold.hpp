@@ -0,0 +1,432 @@
+/*!
+@file
+Defines `boost::hana::experimental::tree_fold` and the reductions built on it.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TREE_FOLD_HPP
+#define BOOST_HANA_EXPERIMENTAL_TREE_FOLD_HPP
+
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/mult.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Reduces a non-empty structure with an associative binary function,
+    //! without imposing a left-to-right order on the operations.
+    //!
+    //! `tree_fold(xs, f)` returns the same value as `hana::fold_left(xs, f)`
+    //! when `f` is associative, but the calls to `f` do not form a single
+    //! chain in which each call needs the result of the previous one. This
+    //! lets the processor perform several calls at once, and lets the
+    //! compiler vectorize the reduction, which it may not do for
+    //! `hana::fold_left` because reordering floating point operations
+    //! changes the result. Concretely,
+    //! 1. When the elements have the same type and are stored contiguously
+    //!    (e.g. a `hana::tuple<double, ...>` or a `std::array`), and when `f`
+    //!    returns that type, the elements are split in 8 contiguous blocks
+    //!    which are reduced by a single loop, and the 8 results are then
+    //!    combined pairwise.
+    //! 2. Otherwise, `f` is applied as a balanced binary tree, i.e.
+    //!    `f(f(x1, x2), f(x3, x4))` for 4 elements.
+    //!
+    //! When `BOOST_HANA_CONFIG_ENABLE_SIMD` is defined, the first case uses
+    //! vector registers explicitly through the GCC and Clang vector
+    //! extensions if `f` is `hana::plus`, `hana::mult` or the function used
+    //! by `tree_maximum` and `tree_minimum`, and if the elements are integers
+    //! other than `bool`, `float`s or `double`s. These functions are also
+    //! commutative, so the elements are accumulated in as many interleaved
+    //! accumulators as a vector register holds. This path is not `constexpr`.
+    //!
+    //! Since the operations are reordered, the result of `tree_fold` may be
+    //! slightly different from the result of `hana::fold_left` for floating
+    //! point numbers.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/tree_fold.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_fold = [](auto&& xs, auto&& f) {
+        return tag-dispatched;
+    };
+#else
+    namespace tree_fold_detail {
+        // Folds the `n` arguments starting at index `b` as a balanced tree.
+        template <std::size_t b, std::size_t n>
+        struct tree {
+            template <typename F, typename Args>
+            static constexpr auto apply(F& f, Args& args) {
+                return f(tree<b, n / 2>::apply(f, args),
+                         tree<b + n / 2, n - n / 2>::apply(f, args));
+            }
+        };
+
+        template <std::size_t b>
+        struct tree<b, 1> {
+            template <typename F, typename Args>
+            static constexpr decltype(auto) apply(F&, Args& args) {
+                using X = typename std::tuple_element<b, Args>::type;
+                return static_cast<X>(std::get<b>(args));
+            }
+        };
+
+        template <typename F>
+        struct unpacked {
+            F& f;
+
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                static_assert(sizeof...(X) != 0,
+                "hana::experimental::tree_fold(xs, f) requires 'xs' to be non-empty");
+
+                auto args = std::forward_as_tuple(static_cast<X&&>(x)...);
+                return tree<0, sizeof...(X)>::apply(f, args);
+            }
+        };
+
+        // Number of accumulators used for homogeneous sequences.
+        constexpr std::size_t lanes = 8;
+
+        template <typename T>
+        struct accumulators {
+            T value[lanes];
+        };
+
+        template <typename Xs, typename F, typename Storage = detail::homogeneous_storage<
+            typename detail::decay<Xs>::type
+        >, bool = Storage::value>
+        struct use_accumulators {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xs, typename F, typename Storage>
+        struct use_accumulators<Xs, F, Storage, true> {
+            using Ref = typename detail::homogeneous_elements<Xs>::reference;
+            using T = typename detail::decay<Ref>::type;
+            static constexpr bool value =
+                Storage::size >= 2 * lanes &&
+                std::is_move_assignable<T>::value &&
+                std::is_same<decltype(std::declval<F&>()(std::declval<T>(), std::declval<Ref>())), T>::value &&
+                std::is_same<decltype(std::declval<F&>()(std::declval<T>(), std::declval<T>())), T>::value;
+        };
+
+        template <typename T, typename Elements, std::size_t ...k>
+        constexpr accumulators<T> first_lanes(Elements const& e, std::size_t block,
+                                              std::index_sequence<k...>)
+        { return {{e[k * block]...}}; }
+
+        // The accumulators are updated with constant indices, so that the
+        // compiler can keep them in registers.
+        template <typename T, typename Elements, typename F, std::size_t ...k>
+        constexpr void step(accumulators<T>& acc, Elements const& e, F& f,
+                            std::size_t block, std::size_t j, std::index_sequence<k...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(
+                acc.value[k] = f(std::move(acc.value[k]), e[k * block + j])
+            ), 0)...};
+        }
+
+        // Each accumulator reduces a contiguous block of elements, so that
+        // `f` only needs to be associative. The blocks are then combined
+        // pairwise, in order.
+        template <typename Xs, typename F>
+        constexpr auto accumulate(Xs& xs, F& f) {
+            detail::homogeneous_elements<Xs> e{xs};
+            using T = typename use_accumulators<Xs, F>::T;
+            constexpr std::size_t block = e.size / lanes;
+            auto acc = tree_fold_detail::first_lanes<T>(e, block,
+                                                        std::make_index_sequence<lanes>{});
+
+            for (std::size_t j = 1; j != block; ++j)
+                tree_fold_detail::step(acc, e, f, block, j, std::make_index_sequence<lanes>{});
+            for (std::size_t i = lanes * block; i != e.size; ++i)
+                acc.value[lanes - 1] = f(std::move(acc.value[lanes - 1]), e[i]);
+
+            for (std::size_t width = 1; width != lanes; width *= 2)
+                for (std::size_t k = 0; k != lanes; k += 2 * width)
+                    acc.value[k] = f(std::move(acc.value[k]), std::move(acc.value[k + width]));
+            return std::move(acc.value[0]);
+        }
+
+        struct max_fn {
+            template <typename X, typename Y>
+            constexpr auto operator()(X&& x, Y&& y) const {
+                auto result = hana::less(x, y);
+                return hana::if_(result, static_cast<Y&&>(y), static_cast<X&&>(x));
+            }
+        };
+
+        struct min_fn {
+            template <typename X, typename Y>
+            constexpr auto operator()(X&& x, Y&& y) const {
+                auto result = hana::less(y, x);
+                return hana::if_(result, static_cast<Y&&>(y), static_cast<X&&>(x));
+            }
+        };
+
+        template <typename F>
+        struct simd_op {
+            static constexpr bool value = false;
+        };
+
+#if defined(BOOST_HANA_CONFIG_ENABLE_SIMD) && defined(__GNUC__)
+        template <>
+        struct simd_op<plus_t> {
+            static constexpr bool value = true;
+            template <typename V>
+            static void apply(V& a, V const& b) { a += b; }
+        };
+
+        template <>
+        struct simd_op<mult_t> {
+            static constexpr bool value = true;
+            template <typename V>
+            static void apply(V& a, V const& b) { a *= b; }
+        };
+
+        template <>
+        struct simd_op<max_fn> {
+            static constexpr bool value = true;
+            template <typename V>
+            static void apply(V& a, V const& b) { a = a < b ? b : a; }
+        };
+
+        template <>
+        struct simd_op<min_fn> {
+            static constexpr bool value = true;
+            template <typename V>
+            static void apply(V& a, V const& b) { a = b < a ? b : a; }
+        };
+
+        // Vectors larger than the registers of the target are split by the
+        // compiler, often going through memory, so the size of the vectors
+        // matches the registers: 32 bytes with AVX, and 16 bytes otherwise.
+#if defined(__AVX__)
+        constexpr std::size_t simd_bytes = 32;
+#else
+        constexpr std::size_t simd_bytes = 16;
+#endif
+
+        template <typename T>
+        struct simd_vector {
+            typedef T type __attribute__((vector_size(simd_bytes)));
+        };
+
+        template <typename T>
+        struct simd_element {
+            static constexpr bool value =
+                (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+                std::is_same<T, float>::value || std::is_same<T, double>::value;
+        };
+
+        template <typename Xs, typename F, bool = use_accumulators<Xs, F>::value>
+        struct use_simd {
+            static constexpr bool value = false;
+        };
+
+        // Like the scalar accumulators, several vectors are accumulated at
+        // once, so the loop is not limited by the latency of each operation.
+        constexpr std::size_t simd_accumulators = 4;
+
+        template <typename Xs, typename F>
+        struct use_simd<Xs, F, true> {
+            using T = typename use_accumulators<Xs, F>::T;
+            static constexpr bool value =
+                simd_op<typename detail::decay<F>::type>::value && simd_element<T>::value &&
+                detail::homogeneous_elements<Xs>::size >= simd_accumulators * simd_bytes / sizeof(T);
+        };
+
+        template <typename V, typename T>
+        V simd_load(T const* data) {
+            V v;
+            std::memcpy(&v, data, sizeof(V));
+            return v;
+        }
+
+        template <typename Xs, typename F>
+        auto vectorize(Xs& xs, F& f) {
+            detail::homogeneous_elements<Xs> e{xs};
+            using T = typename use_accumulators<Xs, F>::T;
+            using V = typename simd_vector<T>::type;
+            using Op = simd_op<typename detail::decay<F>::type>;
+            constexpr std::size_t width = sizeof(V) / sizeof(T);
+            constexpr std::size_t vectors = e.size / width;
+            constexpr std::size_t chunks = vectors / simd_accumulators;
+
+            V acc0 = tree_fold_detail::simd_load<V>(e.data);
+            V acc1 = tree_fold_detail::simd_load<V>(e.data + width);
+            V acc2 = tree_fold_detail::simd_load<V>(e.data + 2 * width);
+            V acc3 = tree_fold_detail::simd_load<V>(e.data + 3 * width);
+            for (std::size_t c = 1; c != chunks; ++c) {
+                T const* chunk = e.data + c * simd_accumulators * width;
+                Op::apply(acc0, tree_fold_detail::simd_load<V>(chunk));
+                Op::apply(acc1, tree_fold_detail::simd_load<V>(chunk + width));
+                Op::apply(acc2, tree_fold_detail::simd_load<V>(chunk + 2 * width));
+                Op::apply(acc3, tree_fold_detail::simd_load<V>(chunk + 3 * width));
+            }
+            for (std::size_t v = chunks * simd_accumulators; v != vectors; ++v)
+                Op::apply(acc0, tree_fold_detail::simd_load<V>(e.data + v * width));
+            Op::apply(acc0, acc1);
+            Op::apply(acc2, acc3);
+            Op::apply(acc0, acc2);
+
+            T result = acc0[0];
+            for (std::size_t k = 1; k != width; ++k)
+                result = f(result, static_cast<T>(acc0[k]));
+            for (std::size_t i = vectors * width; i != e.size; ++i)
+                result = f(result, e[i]);
+            return result;
+        }
+#else
+        template <typename Xs, typename F>
+        struct use_simd {
+            static constexpr bool value = false;
+        };
+#endif
+    }
+
+    struct tree_fold_t {
+        template <typename Xs, typename F>
+        constexpr auto apply(Xs&& xs, F& f, hana::int_<0>) const {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                tree_fold_detail::unpacked<F>{f});
+        }
+
+        template <typename Xs, typename F>
+        constexpr auto apply(Xs&& xs, F& f, hana::int_<1>) const
+        { return tree_fold_detail::accumulate<Xs>(xs, f); }
+
+#if defined(BOOST_HANA_CONFIG_ENABLE_SIMD) && defined(__GNUC__)
+        template <typename Xs, typename F>
+        auto apply(Xs&& xs, F& f, hana::int_<2>) const
+        { return tree_fold_detail::vectorize<Xs>(xs, f); }
+#endif
+
+        template <typename Xs, typename F>
+        constexpr auto operator()(Xs&& xs, F&& f) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            using S = typename hana::tag_of<Xs>::type;
+            static_assert(hana::Foldable<S>::value,
+            "hana::experimental::tree_fold(xs, f) requires 'xs' to be Foldable");
+        #endif
+
+            constexpr int strategy = tree_fold_detail::use_simd<Xs, F>::value ? 2
+                                   : tree_fold_detail::use_accumulators<Xs, F>::value ? 1
+                                   : 0;
+            return apply(static_cast<Xs&&>(xs), f, hana::int_c<strategy>);
+        }
+    };
+
+    constexpr tree_fold_t tree_fold{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Sum of the elements of a non-empty structure, computed with
+    //! `tree_fold`.
+    //!
+    //! This is equivalent to `tree_fold(xs, hana::plus)`. Unlike `hana::sum`,
+    //! no `Monoid` has to be given since the structure may not be empty.
+    //! For floating point numbers, the result may differ slightly from
+    //! `hana::sum` since the additions are performed in a different order.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_sum = [](auto&& xs) {
+        return tree_fold(forwarded(xs), hana::plus);
+    };
+#else
+    struct tree_sum_t {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const
+        { return experimental::tree_fold(static_cast<Xs&&>(xs), hana::plus); }
+    };
+
+    constexpr tree_sum_t tree_sum{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Product of the elements of a non-empty structure, computed with
+    //! `tree_fold`.
+    //!
+    //! This is equivalent to `tree_fold(xs, hana::mult)`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_product = [](auto&& xs) {
+        return tree_fold(forwarded(xs), hana::mult);
+    };
+#else
+    struct tree_product_t {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const
+        { return experimental::tree_fold(static_cast<Xs&&>(xs), hana::mult); }
+    };
+
+    constexpr tree_product_t tree_product{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Greatest element of a non-empty structure, computed with `tree_fold`.
+    //!
+    //! This returns a copy of the same element as `hana::maximum(xs)`, except
+    //! that another one of several equal greatest elements may be returned.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_maximum = [](auto&& xs) {
+        return tree_fold(forwarded(xs), [](auto&& x, auto&& y) {
+            return hana::if_(hana::less(x, y), y, x);
+        });
+    };
+#else
+    struct tree_maximum_t {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const {
+            return experimental::tree_fold(static_cast<Xs&&>(xs),
+                                           tree_fold_detail::max_fn{});
+        }
+    };
+
+    constexpr tree_maximum_t tree_maximum{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Least element of a non-empty structure, computed with `tree_fold`.
+    //!
+    //! This returns a copy of the same element as `hana::minimum(xs)`, except
+    //! that another one of several equal least elements may be returned.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_minimum = [](auto&& xs) {
+        return tree_fold(forwarded(xs), [](auto&& x, auto&& y) {
+            return hana::if_(hana::less(y, x), y, x);
+        });
+    };
+#else
+    struct tree_minimum_t {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const {
+            return experimental::tree_fold(static_cast<Xs&&>(xs),
+                                           tree_fold_detail::min_fn{});
+        }
+    };
+
+    constexpr tree_minimum_t tree_minimum{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TREE_FOLD_HPP
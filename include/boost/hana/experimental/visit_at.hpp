@@ -0,0 +1,85 @@
+/*!
+@file
+Defines `boost::hana::experimental::visit_at`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_VISIT_AT_HPP
+#define BOOST_HANA_EXPERIMENTAL_VISIT_AT_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/iterable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/experimental/visit_index.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Calls a function with the element of an `Iterable` at a runtime
+    //! index.
+    //!
+    //! Given an `Iterable` and `Foldable` structure `xs` (e.g. a
+    //! `hana::tuple`), a runtime index `i` and a function `f`, `visit_at`
+    //! calls `f` with `hana::at_c<i>(xs)`, forwarding the value category of
+    //! `xs`. `i` may be of any integral type. By default, it is first
+    //! checked to be smaller than the length of `xs`, without being
+    //! narrowed, and `visit_at` returns whether `f` was called. When
+    //! `hana::experimental::unchecked` is given as the last argument, that
+    //! check is omitted and `i` must be a valid index.
+    //!
+    //! Like `visit_index`, this compiles to a single indirect call through a
+    //! table with one entry per element, instead of a sequence of
+    //! comparisons. `f` must be callable with each element of `xs`, but its
+    //! return value is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/visit_at.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto visit_at = [](auto&& xs, auto i, auto&& f[, unchecked]) -> bool {
+        return tag-dispatched;
+    };
+#else
+    namespace visit_at_detail {
+        template <typename Xs, typename F>
+        struct at_fn {
+            Xs&& xs;
+            F& f;
+
+            template <typename I>
+            void operator()(I const& i) const
+            { f(hana::at(static_cast<Xs&&>(xs), i)); }
+        };
+    }
+
+    struct visit_at_t {
+        template <typename Xs, typename I, typename F, typename ...Policy>
+        bool operator()(Xs&& xs, I i, F&& f, Policy const& ...policy) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            using S = typename hana::tag_of<Xs>::type;
+            static_assert(hana::Iterable<S>::value && hana::Foldable<S>::value,
+            "hana::experimental::visit_at(xs, i, f) requires 'xs' to be Iterable and Foldable");
+        #endif
+
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            visit_at_detail::at_fn<Xs, F> at{static_cast<Xs&&>(xs), f};
+            return experimental::visit_index(hana::range_c<std::size_t, 0, N>,
+                                             i, at, policy...);
+        }
+    };
+
+    constexpr visit_at_t visit_at{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_VISIT_AT_HPP
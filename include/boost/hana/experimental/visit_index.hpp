@@ -0,0 +1,144 @@
+/*!
+@file
+Defines `boost::hana::experimental::visit_index`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_VISIT_INDEX_HPP
+#define BOOST_HANA_EXPERIMENTAL_VISIT_INDEX_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Bounds-checking policy telling `visit_index` and `visit_at` that the
+    //! runtime index is known to be valid.
+    //!
+    //! With this policy, the runtime index is not compared to the bounds
+    //! before jumping through the table, and calling `visit_index` or
+    //! `visit_at` with an index out of bounds is undefined behavior.
+    struct unchecked_t { };
+    constexpr unchecked_t unchecked{};
+
+    //! @ingroup group-experimental
+    //! Calls a function with the `IntegralConstant` of a `hana::range`
+    //! equal to a runtime integer.
+    //!
+    //! Given a `hana::range` `[from, to)`, a runtime integer `n` and a
+    //! function `f`, `visit_index` calls `f` with `hana::integral_c<T, n>`,
+    //! where `T` is the type of the range's elements. `n` may be of any
+    //! integral type, and it is compared to the bounds of the range by
+    //! value, without being converted to `T`. By default, `n` is first
+    //! checked to be in the range, and `visit_index` returns whether
+    //! `f` was called. When `hana::experimental::unchecked` is given as the
+    //! last argument, that check is omitted and `n` must be in the range.
+    //!
+    //! Whatever the size of the range, this compiles to a single indirect
+    //! call through a table with one entry per element of the range, instead
+    //! of a sequence of comparisons. `f` must be callable with each element
+    //! of the range, but its return value is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/visit_index.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto visit_index = [](auto const& range, auto n, auto&& f[, unchecked]) -> bool {
+        return tag-dispatched;
+    };
+#else
+    namespace visit_index_detail {
+        // Defined outside of `table` so the mangled name of each handler
+        // does not contain the whole sequence of indices.
+        template <typename T, T n, typename F>
+        void call(F& f) { f(hana::integral_c<T, n>); }
+
+        template <typename T, T from, typename Indices>
+        struct table;
+
+        template <typename T, T from, std::size_t ...i>
+        struct table<T, from, std::index_sequence<i...>> {
+            template <typename F>
+            static void apply(std::size_t index, F& f) {
+                using Handler = void(*)(F&);
+                static constexpr Handler handlers[sizeof...(i) + 1] = {
+                    &call<T, static_cast<T>(from + static_cast<T>(i)), F>..., nullptr
+                };
+                handlers[index](f);
+            }
+        };
+
+        template <typename T, T from, T to>
+        using table_for = table<T, from,
+            std::make_index_sequence<static_cast<std::size_t>(to - from)>>;
+
+        // Compares integers of different types by value. Neither of them is
+        // narrowed, so an index wider than `std::size_t` (e.g. `__int128`,
+        // or a 64-bit integer on a 32-bit target) is never truncated into
+        // the range.
+        template <typename X>
+        using is_signed = std::integral_constant<bool, (X(-1) < X(0))>;
+
+        template <typename X, typename Y>
+        constexpr bool less(X x, Y y, std::true_type, std::false_type) {
+            using C = std::common_type_t<X, Y>;
+            return x < 0 || static_cast<C>(x) < static_cast<C>(y);
+        }
+
+        template <typename X, typename Y>
+        constexpr bool less(X x, Y y, std::false_type, std::true_type) {
+            using C = std::common_type_t<X, Y>;
+            return y > 0 && static_cast<C>(x) < static_cast<C>(y);
+        }
+
+        template <typename X, typename Y, typename Signed>
+        constexpr bool less(X x, Y y, Signed, Signed)
+        { return x < y; }
+
+        template <typename X, typename Y>
+        constexpr bool less(X x, Y y)
+        { return visit_index_detail::less(x, y, is_signed<X>{}, is_signed<Y>{}); }
+
+        // Once `n` is known to be in `[from, to)`, `n - from` is smaller than
+        // the size of the range and is computed in the common type without
+        // overflowing.
+        template <typename T, T from, typename N>
+        constexpr std::size_t offset(N n) {
+            using C = std::common_type_t<N, T>;
+            return static_cast<std::size_t>(static_cast<C>(n) - static_cast<C>(from));
+        }
+    }
+
+    struct visit_index_t {
+        template <typename T, T from, T to, typename N, typename F>
+        bool operator()(hana::range<T, from, to> const&, N n, F&& f) const {
+            if (visit_index_detail::less(n, from) || !visit_index_detail::less(n, to))
+                return false;
+            visit_index_detail::table_for<T, from, to>::apply(
+                visit_index_detail::offset<T, from>(n), f);
+            return true;
+        }
+
+        template <typename T, T from, T to, typename N, typename F>
+        bool operator()(hana::range<T, from, to> const&, N n, F&& f, unchecked_t) const {
+            visit_index_detail::table_for<T, from, to>::apply(
+                visit_index_detail::offset<T, from>(n), f);
+            return true;
+        }
+    };
+
+    constexpr visit_index_t visit_index{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_VISIT_INDEX_HPP
@@ -0,0 +1,99 @@
+/*!
+@file
+Defines `boost::hana::experimental::visit_key`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_VISIT_KEY_HPP
+#define BOOST_HANA_EXPERIMENTAL_VISIT_KEY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Calls a function with the compile-time string equal to a runtime
+    //! string.
+    //!
+    //! Given a `Foldable` containing `hana::string`s, a runtime string and
+    //! a function `f`, `visit_key` calls `f` with the `hana::string` equal
+    //! to the runtime string, and returns whether there was such a string.
+    //! The runtime string can be any object with `data()` and `size()`
+    //! members, like `std::string` or `std::string_view`, or it can be
+    //! given as a pointer and a size.
+    //!
+    //! The lookup is done in constant time, using a perfect hash function
+    //! computed at compile-time for the given keys: the runtime string is
+    //! hashed once, compared with a single key, and `f` is then called
+    //! through a table with one entry per key. `f` must be callable with
+    //! each key, but its return value is ignored.
+    //!
+    //! This can be used to access the element of a `hana::map` or the
+    //! member of a `Struct` whose name is only known at runtime, by using
+    //! their `hana::keys`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/visit_key.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto visit_key = [](auto const& keys, auto const& string, auto&& f) -> bool {
+        return tag-dispatched;
+    };
+#else
+    namespace visit_key_detail {
+        template <typename ...Keys>
+        struct visitor {
+            template <typename Key, typename F>
+            static void call(F& f) { f(Key{}); }
+
+            template <typename F>
+            static bool apply(char const* s, std::size_t size, F& f) {
+                using Hash = detail::perfect_hash<Keys...>;
+                using Handler = void(*)(F&);
+                static constexpr Handler handlers[sizeof...(Keys) + 1] = {
+                    &call<Keys, F>..., nullptr
+                };
+
+                std::size_t index = Hash::find(s, size);
+                if (index == sizeof...(Keys))
+                    return false;
+                handlers[index](f);
+                return true;
+            }
+        };
+
+        struct make_visitor {
+            template <typename ...Keys>
+            constexpr visitor<typename std::decay<Keys>::type...>
+            operator()(Keys&& ...) const { return {}; }
+        };
+    }
+
+    struct visit_key_t {
+        template <typename Keys, typename F>
+        bool operator()(Keys const& keys, char const* s, std::size_t size, F&& f) const {
+            using Visitor = decltype(hana::unpack(keys, visit_key_detail::make_visitor{}));
+            return Visitor::apply(s, size, f);
+        }
+
+        template <typename Keys, typename String, typename F>
+        bool operator()(Keys const& keys, String const& string, F&& f) const {
+            return (*this)(keys, string.data(), string.size(), f);
+        }
+    };
+
+    constexpr visit_key_t visit_key{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_VISIT_KEY_HPP
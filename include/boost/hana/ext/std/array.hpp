@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
@@ -74,6 +75,22 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = ext::std::array_tag;
     };
 
+    namespace detail {
+        template <typename T, std::size_t N>
+        struct homogeneous_storage<std::array<T, N>> {
+            static constexpr bool value = N != 0;
+            static constexpr std::size_t size = N;
+
+            // `std::get` is used because it is `constexpr` in C++14, unlike
+            // the non-const `operator[]`.
+            static constexpr T* data(std::array<T, N>& xs)
+            { return &std::get<0>(xs); }
+
+            static constexpr T const* data(std::array<T, N> const& xs)
+            { return &std::get<0>(xs); }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
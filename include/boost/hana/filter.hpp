@@ -96,6 +96,21 @@ BOOST_HANA_NAMESPACE_BEGIN
             static constexpr auto cached_indices = compute_indices();
         };
 
+        // Turns the indices computed by a type like `filter_indices` into
+        // a `std::index_sequence`.
+        template <typename Indices,
+                  typename = std::make_index_sequence<Indices::cached_indices.size()>>
+        struct cached_index_sequence;
+
+        template <typename Indices, std::size_t ...n>
+        struct cached_index_sequence<Indices, std::index_sequence<n...>> {
+            using type = std::index_sequence<Indices::cached_indices[n]...>;
+        };
+
+        // `operator()` is only called in an unevaluated context, but it is
+        // odr-used by the instantiation of `unpack`, so it must be defined.
+        // The same goes for the other function objects passed to `unpack`
+        // to compute a type.
         template <typename Pred>
         struct make_filter_indices {
             Pred const& pred;
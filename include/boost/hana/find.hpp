@@ -12,11 +12,26 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/find.hpp>
 
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/hashable.hpp>
 #include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find_if.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -56,6 +71,94 @@ BOOST_HANA_NAMESPACE_BEGIN
                                  detail::equal_to<Key>{key});
         }
     };
+
+    namespace struct_detail {
+        template <typename Accessors>
+        struct MemberNameAtIndex {
+            template <std::size_t i>
+            using apply = typename detail::decay<decltype(
+                hana::first(hana::at_c<i>(std::declval<Accessors>()))
+            )>::type;
+        };
+
+        // The `hash_table` indexing the names of the members of a Struct.
+        // It is only computed (once per Struct) when the members are looked
+        // up by name, and only when all the names are `Hashable`, which is
+        // the case for the `hana::string`s used by `BOOST_HANA_DEFINE_STRUCT`
+        // and `BOOST_HANA_ADAPT_STRUCT`. Like the keys of a `hana::map`, the
+        // names are assumed to be unique.
+        template <typename S,
+                  typename Accessors = decltype(hana::accessors<S>()),
+                  typename Indices = std::make_index_sequence<
+                    decltype(hana::length(std::declval<Accessors>()))::value>>
+        struct member_table;
+
+        template <typename S, typename Accessors, std::size_t ...i>
+        struct member_table<S, Accessors, std::index_sequence<i...>> {
+            using NameAtIndex = MemberNameAtIndex<Accessors>;
+
+            static constexpr bool hashable = sizeof...(i) > 0 &&
+                detail::fast_and<hana::Hashable<
+                    typename NameAtIndex::template apply<i>
+                >::value...>::value;
+
+            using type = typename detail::make_bulk_hash_table<
+                NameAtIndex::template apply, sizeof...(i)
+            >::type;
+        };
+
+        // Whether the member with the given name can be looked up in the
+        // `member_table` of `S`, instead of comparing the name with every
+        // member's name.
+        template <typename S, typename Key>
+        struct has_member_table {
+            static constexpr bool value = member_table<S>::hashable &&
+                hana::Hashable<Key>::value;
+        };
+
+        // Returns the index of the member with the given name as a
+        // `hana::optional`. This may only be used if `has_member_table`.
+        template <typename S, typename Key>
+        struct find_member_index {
+            using Table = member_table<S>;
+            using type = typename detail::find_index<
+                typename Table::type, Key, Table::NameAtIndex::template apply
+            >::type;
+        };
+
+        template <typename S, typename X>
+        struct get_member_at {
+            X&& x;
+            template <typename I>
+            constexpr decltype(auto) operator()(I const&) && {
+                return hana::second(hana::at_c<I::value>(hana::accessors<S>()))(
+                    static_cast<X&&>(x)
+                );
+            }
+        };
+    }
+
+    template <typename S>
+    struct find_impl<S, when<hana::Struct<S>::value>> {
+        template <typename X, typename Key>
+        static constexpr auto apply_impl(X&& x, Key const&, hana::true_) {
+            using MaybeIndex = typename struct_detail::find_member_index<S, Key>::type;
+            return hana::transform(MaybeIndex{},
+                struct_detail::get_member_at<S, X>{static_cast<X&&>(x)});
+        }
+
+        template <typename X, typename Key>
+        static constexpr auto apply_impl(X&& x, Key const& key, hana::false_) {
+            return hana::find_if(static_cast<X&&>(x),
+                                 detail::equal_to<Key>{key});
+        }
+
+        template <typename X, typename Key>
+        static constexpr auto apply(X&& x, Key const& key) {
+            return apply_impl(static_cast<X&&>(x), key,
+                hana::bool_c<struct_detail::has_member_table<S, Key>::value>);
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FIND_HPP
@@ -12,13 +12,19 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/fold_left.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -71,19 +77,67 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
+    namespace detail {
+        // The state of a fold can be kept in a variable updated by a loop
+        // when `f` returns the same non-reference type at each step.
+        template <typename F, typename R, typename Ref, bool = !std::is_reference<R>::value &&
+                                                              std::is_move_assignable<R>::value>
+        struct fold_left_state {
+            static constexpr bool value = false;
+        };
+
+        template <typename F, typename R, typename Ref>
+        struct fold_left_state<F, R, Ref, true> {
+            static constexpr bool value = std::is_same<
+                decltype(std::declval<F&>()(std::declval<R>(), std::declval<Ref>())), R
+            >::value;
+        };
+
+        // `S` is `void` when there is no initial state, in which case the
+        // fold starts with the first element.
+        template <typename Xs, typename S, typename F, bool = detail::use_loop<Xs>::value>
+        struct fold_left_loop {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xs, typename S, typename F>
+        struct fold_left_loop<Xs, S, F, true> {
+            using Ref = typename detail::homogeneous_elements<Xs>::reference;
+            using First = typename std::conditional<std::is_void<S>::value, Ref, S>::type;
+            using R = decltype(std::declval<F&>()(std::declval<First>(), std::declval<Ref>()));
+            static constexpr bool value = fold_left_state<F, R, Ref>::value;
+        };
+    }
+
     template <typename T, bool condition>
     struct fold_left_impl<T, when<condition>> : default_ {
         // with state
         template <typename Xs, typename S, typename F>
-        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+        static constexpr decltype(auto) apply_impl(Xs&& xs, S&& s, F&& f, hana::false_) {
             return hana::unpack(static_cast<Xs&&>(xs),
                 detail::variadic_foldl1<F, S>{f, s}
             );
         }
 
+        template <typename Xs, typename S, typename F>
+        static constexpr auto apply_impl(Xs&& xs, S&& s, F&& f, hana::true_) {
+            detail::homogeneous_elements<Xs> e{xs};
+            auto state = f(static_cast<S&&>(s), e[0]);
+            for (std::size_t i = 1; i != e.size; ++i)
+                state = f(std::move(state), e[i]);
+            return state;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                              static_cast<F&&>(f),
+                              hana::bool_c<detail::fold_left_loop<Xs, S, F>::value>);
+        }
+
         // without state
         template <typename Xs, typename F>
-        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+        static constexpr decltype(auto) apply_impl(Xs&& xs, F&& f, hana::false_) {
             return hana::unpack(static_cast<Xs&&>(xs),
                 hana::partial(
                     detail::variadic::foldl1,
@@ -91,6 +145,21 @@ BOOST_HANA_NAMESPACE_BEGIN
                 )
             );
         }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply_impl(Xs&& xs, F&& f, hana::true_) {
+            detail::homogeneous_elements<Xs> e{xs};
+            auto state = f(e[0], e[1]);
+            for (std::size_t i = 2; i != e.size; ++i)
+                state = f(std::move(state), e[i]);
+            return state;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                              hana::bool_c<detail::fold_left_loop<Xs, void, F>::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
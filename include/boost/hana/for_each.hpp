@@ -12,11 +12,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/for_each.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -51,11 +55,24 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename T, bool condition>
     struct for_each_impl<T, when<condition>> : default_ {
         template <typename Xs, typename F>
-        static constexpr void apply(Xs&& xs, F&& f) {
+        static constexpr void apply_impl(Xs&& xs, F&& f, hana::false_) {
             // We use a pointer instead of a reference to avoid a Clang ICE.
             hana::unpack(static_cast<Xs&&>(xs),
                          detail::on_each<decltype(&f)>{&f});
         }
+
+        template <typename Xs, typename F>
+        static constexpr void apply_impl(Xs&& xs, F&& f, hana::true_) {
+            detail::homogeneous_elements<Xs> e{xs};
+            for (std::size_t i = 0; i != e.size; ++i)
+                (void)f(e[i]);
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                              hana::bool_c<detail::use_loop<Xs>::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
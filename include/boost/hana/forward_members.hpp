@@ -0,0 +1,75 @@
+/*!
+@file
+Defines `boost::hana::forward_members`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FORWARD_MEMBERS_HPP
+#define BOOST_HANA_FORWARD_MEMBERS_HPP
+
+#include <boost/hana/fwd/forward_members.hpp>
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Object>
+    constexpr auto forward_members_t::operator()(Object&& object) const {
+        using S = typename hana::tag_of<Object>::type;
+        using ForwardMembers = BOOST_HANA_DISPATCH_IF(forward_members_impl<S>,
+            hana::Struct<S>::value
+        );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Struct<S>::value,
+            "hana::forward_members(object) requires 'object' to be a Struct");
+        #endif
+
+        return ForwardMembers::apply(static_cast<Object&&>(object));
+    }
+    //! @endcond
+
+    namespace struct_detail {
+        // Contrary to `hana::make_tuple`, this keeps the exact type returned
+        // by each accessor, so references to the members are not decayed.
+        template <typename Object>
+        struct forward_members_helper {
+            Object& object;
+
+            template <typename ...Accessors>
+            constexpr auto operator()(Accessors&& ...accessors) const {
+                return hana::tuple<decltype(
+                    hana::second(static_cast<Accessors&&>(accessors))(
+                        static_cast<Object&&>(object)
+                    )
+                )...>{
+                    hana::second(static_cast<Accessors&&>(accessors))(
+                        static_cast<Object&&>(object)
+                    )...
+                };
+            }
+        };
+    }
+
+    template <typename S, bool condition>
+    struct forward_members_impl<S, when<condition>> : default_ {
+        template <typename Object>
+        static constexpr auto apply(Object&& object) {
+            return hana::unpack(hana::accessors<S>(),
+                struct_detail::forward_members_helper<Object>{object}
+            );
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FORWARD_MEMBERS_HPP
@@ -21,6 +21,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! If the structure is not finite, `predicate` has to be satisfied
     //! after looking at a finite number of keys for this method to finish.
     //!
+    //! For `Sequence`s, the type of `predicate(k)` is computed for every
+    //! key `k` before any of them is looked at, even when a previous key
+    //! satisfies the `predicate` at compile-time. Hence, `predicate(k)`
+    //! must be well-formed for all the keys of a `Sequence`, which also
+    //! holds for `all_of` and `none_of`. When the results are not all
+    //! `IntegralConstant`s, `predicate` is only called at runtime until
+    //! it is satisfied.
+    //!
     //!
     //! @param xs
     //! The structure to search.
@@ -22,6 +22,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! `find_if(xs, pred)` returns `just` the first element whose key
     //! satisfies the predicate, or `nothing` if there is no such element.
     //!
+    //! For `Iterable`s that are also `Foldable`, like `hana::tuple`, the
+    //! type of `predicate(k)` is computed for every key `k` before any of
+    //! them is looked at, even when a previous key satisfies the `predicate`,
+    //! as done by `index_if`. Hence, `predicate(k)` must be well-formed for
+    //! all the keys of such a structure.
+    //!
     //!
     //! @param xs
     //! The structure to be searched.
@@ -0,0 +1,64 @@
+/*!
+@file
+Forward declares `boost::hana::forward_members`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FORWARD_MEMBERS_HPP
+#define BOOST_HANA_FWD_FORWARD_MEMBERS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Returns a `hana::tuple` of references to the members of a `Struct`.
+    //! @ingroup group-Struct
+    //!
+    //! Like `members`, `forward_members` returns a `Sequence` containing
+    //! all the members of a `Struct`, in the same order as their respective
+    //! accessor appears in the `accessors` sequence. However, instead of
+    //! copying the members into a new tuple, `forward_members` returns a
+    //! tuple holding whatever the accessors return. For the accessors
+    //! created by `BOOST_HANA_DEFINE_STRUCT` and `BOOST_HANA_ADAPT_STRUCT`,
+    //! these are references to the members of the object, whose kind
+    //! depends on the value category of the object:
+    //! - `forward_members(object)` holds `T&`s if `object` is a non-const
+    //!   lvalue, which makes it possible to modify the members through the
+    //!   returned tuple.
+    //! - `forward_members(object)` holds `T const&`s if `object` is a const
+    //!   lvalue.
+    //! - `forward_members(std::move(object))` holds `T&&`s, which makes it
+    //!   possible to move the members out of `object`.
+    //!
+    //! The returned tuple can be used with any algorithm on `Sequence`s,
+    //! like `for_each`, `fold_left` or `zip_with`, without ever copying the
+    //! members. Note that algorithms creating new tuples, like `zip`, still
+    //! copy the elements they put in those tuples. Also, since the returned
+    //! tuple refers to the members of `object`, it must not outlive `object`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/forward_members.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto forward_members = [](auto&& object) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct forward_members_impl : forward_members_impl<S, when<true>> { };
+
+    struct forward_members_t {
+        template <typename Object>
+        constexpr auto operator()(Object&& object) const;
+    };
+
+    constexpr forward_members_t forward_members{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FORWARD_MEMBERS_HPP
@@ -24,6 +24,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! of the index of the first element that satisfies the predicate or nothing
     //! if no element satisfies the predicate.
     //!
+    //! For `Foldable` structures, the type of `predicate(x)` is computed
+    //! for every element `x` before any of them is looked at, even when a
+    //! previous element satisfies the `predicate`. Hence, `predicate(x)`
+    //! must be well-formed for all the elements of such a structure, which
+    //! also holds for `find_if`. Only the type of `predicate(x)` is needed,
+    //! so a predicate whose body can not be instantiated for some elements
+    //! can still be used by declaring its return type.
+    //!
     //!
     //! @param xs
     //! The structure to be searched.
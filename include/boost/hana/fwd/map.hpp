@@ -147,9 +147,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! different hashes. If you need to create a map with duplicate keys
     //! or with keys whose hashes might collide, use `hana::to_map` or
     //! insert `(key, value)` pairs to an empty map successively. However,
-    //! be aware that doing so will be much more compile-time intensive than
+    //! be aware that doing so will be more compile-time intensive than
     //! using `make<map_tag>`, because the uniqueness of keys will have to be
-    //! enforced.
+    //! enforced. When many pairs are involved, prefer `hana::to_map`, which
+    //! builds the whole map at once, to successive insertions.
     //!
     //!
     //! Example
@@ -269,6 +270,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @code
     //! hana::fold_left(xs, ys, hana::insert)
     //! @endcode
+    //! However, the result is built at once instead of one insertion at a
+    //! time, which makes `hana::union_(map, hana::to_map(pairs))` the
+    //! preferred way of inserting many pairs into a map.
     //!
     //! @param xs, ys
     //! The two maps to compute the union of.
@@ -20,7 +20,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     //!
     //! Given a `Struct` object, `members` returns a `Sequence` containing
     //! all the members of the `Struct`, in the same order as their respective
-    //! accessor appears in the `accessors` sequence.
+    //! accessor appears in the `accessors` sequence. The members are copied
+    //! into the returned sequence; use `forward_members` to refer to them
+    //! instead.
     //!
     //!
     //! Example
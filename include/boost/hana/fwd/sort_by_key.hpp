@@ -0,0 +1,81 @@
+/*!
+@file
+Forward declares `boost::hana::sort_by_key`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_SORT_BY_KEY_HPP
+#define BOOST_HANA_FWD_SORT_BY_KEY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Sort a sequence by a key, and return the permutation that was applied.
+    //! @ingroup group-Sequence
+    //!
+    //! Given a Sequence `xs` and a function `key`, `sort_by_key(xs, key)`
+    //! returns a `hana::pair` whose first element is `sort(xs, ordering(key))`,
+    //! and whose second element is a `hana::tuple` of `hana::size_t`s holding,
+    //! for each element of the sorted sequence, its index in `xs`. Like `sort`,
+    //! `sort_by_key` is stable. Hence,
+    //! @code
+    //!     sort_by_key(xs, key) == make_pair(
+    //!         make<S>(xs[i1], ..., xs[in]),
+    //!         make_tuple(size_c<i1>, ..., size_c<in>)
+    //!     )
+    //! @endcode
+    //!
+    //! where `i1, ..., in` is the unique permutation of `0, ..., n-1` such
+    //! that `key(xs[i1]), ..., key(xs[in])` is sorted, and equal keys appear
+    //! in the same order as in `xs`.
+    //!
+    //! When all the keys are `IntegralConstant`s, the key of each element is
+    //! computed only once, and the permutation is computed by sorting the
+    //! values of the keys in a `constexpr` function, which is much cheaper at compile
+    //! time than instantiating a predicate for each comparison. Otherwise,
+    //! the keys must be compile-time `Orderable`, and they are compared with
+    //! `less` as in `sort(xs, ordering(key))`.
+    //!
+    //!
+    //! Signature
+    //! ---------
+    //! Given a `Sequence` `S(T)` and an `Orderable` `K`, the signature is
+    //! \f[
+    //!     \mathtt{sort\_by\_key} : S(T) \times (T \to K) \to S(T) \times \mathtt{tuple}(\mathtt{size\_t})
+    //! \f]
+    //!
+    //! @param xs
+    //! The sequence to sort.
+    //!
+    //! @param key
+    //! A function called as `key(x)` for each element `x` of the sequence,
+    //! and returning the compile-time key by which `x` is sorted. Only the
+    //! type of `key(x)` is used, so `key` is never actually called.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/sort_by_key.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto sort_by_key = [](auto&& xs, auto&& key) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct sort_by_key_impl : sort_by_key_impl<S, when<true>> { };
+
+    struct sort_by_key_t {
+        template <typename Xs, typename Key>
+        constexpr auto operator()(Xs&& xs, Key&& key) const;
+    };
+
+    constexpr sort_by_key_t sort_by_key{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_SORT_BY_KEY_HPP
@@ -22,6 +22,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -75,10 +76,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename Tag>
     struct index_if_impl<Tag, when<Foldable<Tag>::value>> {
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs const& xs, Pred const&)
-            -> typename detail::iterate_while<0,
-                decltype(hana::length(xs))::value, false>
-                    ::template f<Xs, Pred>
+        static constexpr auto apply(Xs const&, Pred const&)
+            -> typename decltype(hana::unpack(
+                std::declval<Xs>(), detail::make_index_if<Pred>{}
+            ))::type
         { return {}; }
     };
 
@@ -31,7 +31,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
+#include <boost/hana/detail/unpack_flatten.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/filter.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/fold_left.hpp>
@@ -45,6 +47,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/is_subset.hpp>
 #include <boost/hana/fwd/keys.hpp>
+#include <boost/hana/fwd/symmetric_difference.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/integral_constant.hpp>
@@ -206,6 +209,46 @@ BOOST_HANA_NAMESPACE_BEGIN
             >::type;
             using type = detail::map_impl<HashTable, Storage>;
         };
+
+        // Creates a map from a `basic_tuple` of pairs whose keys may not be
+        // unique, keeping only the first pair for each key. Contrary to
+        // inserting the pairs one by one, this does not rebuild the map
+        // for every pair.
+        template <typename Storage>
+        struct map_from_storage {
+            static constexpr std::size_t N = decltype(hana::length(std::declval<Storage>()))::value;
+            using Table = detail::make_bulk_hash_table<
+                detail::KeyAtIndex<Storage>::template apply, N
+            >;
+
+            template <typename Xs, std::size_t ...i>
+            static constexpr auto apply(Xs&& xs, std::index_sequence<i...>) {
+                using NewStorage = decltype(hana::make_basic_tuple(
+                    hana::at_c<i>(static_cast<Xs&&>(xs))...
+                ));
+                return detail::map_impl<typename Table::type, NewStorage>(
+                    hana::make_basic_tuple(hana::at_c<i>(static_cast<Xs&&>(xs))...)
+                );
+            }
+
+            // All the keys were unique; use the storage as-is.
+            template <typename Xs>
+            static constexpr auto apply(Xs&& xs, std::make_index_sequence<N>) {
+                return detail::map_impl<typename Table::type, Storage>(
+                    static_cast<Xs&&>(xs)
+                );
+            }
+
+            template <typename Xs>
+            static constexpr auto apply(Xs&& xs)
+            { return apply(static_cast<Xs&&>(xs), typename Table::indices{}); }
+        };
+
+        template <typename Xs>
+        constexpr auto make_map_from_storage(Xs&& xs) {
+            using Storage = typename detail::decay<Xs>::type;
+            return detail::map_from_storage<Storage>::apply(static_cast<Xs&&>(xs));
+        }
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -391,7 +434,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <>
     struct find_impl<map_tag> {
         template <typename Map>
-        static constexpr auto find_helper(Map&&, ...) {
+        static constexpr auto find_helper(Map&&, hana::optional<>) {
             return hana::nothing;
         }
 
@@ -488,63 +531,94 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct union_impl<map_tag> {
+        // This is equivalent to `hana::fold_left(xs, ys, hana::insert)`,
+        // but the resulting map is built in a single step.
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
-                                   hana::insert);
+            return detail::make_map_from_storage(detail::unpack_flatten(
+                hana::make_basic_tuple(static_cast<Ys&&>(ys).storage,
+                                       static_cast<Xs&&>(xs).storage),
+                hana::make_basic_tuple
+            ));
         }
     };
 
     //////////////////////////////////////////////////////////////////////////
-    // intersection_
+    // intersection, difference and symmetric_difference
     //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename Ys>
-        struct map_insert_if_contains {
-            Ys const& ys;
-
-            // Second template param will be pair
-            // Get its key and check if it exists, if it does, insert key, value pair.
-            template <typename Result, typename Pair>
-            static constexpr auto helper(Result&& result, Pair&& pair, hana::true_) {
-                return hana::insert(static_cast<Result&&>(result), static_cast<Pair&&>(pair));
-            }
+        // Computes the indices of the pairs of a map whose key is (or is
+        // not, when `Keep` is false) contained in the map `Ys`. Each check
+        // is a lookup in the hash table of `Ys`, so this is linear in the
+        // size of both maps.
+        template <typename Ys, bool Keep>
+        struct map_filter_indices {
+            template <typename ...P>
+            constexpr auto operator()(P const& ...) const -> detail::filter_indices<
+                (decltype(hana::contains(std::declval<Ys const&>(),
+                    hana::first(std::declval<P const&>())))::value == Keep)...
+            > { return {}; }
+        };
 
-            template <typename Result, typename Pair>
-            static constexpr auto helper(Result&& result, Pair&&, hana::false_) {
-                return static_cast<Result&&>(result);
-            }
+        template <typename Xs, typename Ys, bool Keep>
+        using map_indices_if_contained = typename detail::cached_index_sequence<
+            decltype(hana::unpack(std::declval<Xs>().storage, detail::map_filter_indices<
+                typename detail::decay<Ys>::type, Keep
+            >{}))
+        >::type;
+
+        // Creates a map holding the pairs at the given indices of a
+        // `basic_tuple`, whose keys must all be different.
+        template <typename Xs, std::size_t ...i>
+        constexpr auto make_map_at(Xs&& xs, std::index_sequence<i...>) {
+            return detail::make_map_from_storage(hana::make_basic_tuple(
+                hana::at_c<i>(static_cast<Xs&&>(xs))...
+            ));
+        }
 
-            template <typename Result, typename Pair>
-            constexpr auto operator()(Result&& result, Pair&& pair) const {
-                constexpr bool keep = hana::value<decltype(hana::contains(ys, hana::first(pair)))>();
-                return map_insert_if_contains::helper(static_cast<Result&&>(result),
-                                                      static_cast<Pair&&>(pair),
-                                                      hana::bool_c<keep>);
-            }
-        };
+        // Creates a map holding the pairs at the given indices of `xs`,
+        // followed by the pairs at the given indices of `ys`. None of these
+        // pairs may have equal keys, so the map is built in a single step.
+        template <typename Xs, typename Ys, std::size_t ...i, std::size_t ...j>
+        constexpr auto map_merge(Xs&& xs, std::index_sequence<i...>,
+                                 Ys&& ys, std::index_sequence<j...>)
+        {
+            return detail::make_map_from_storage(hana::make_basic_tuple(
+                hana::at_c<i>(static_cast<Xs&&>(xs).storage)...,
+                hana::at_c<j>(static_cast<Ys&&>(ys).storage)...
+            ));
+        }
     }
 
     template <>
     struct intersection_impl<map_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys const& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), hana::make_map(),
-                                   detail::map_insert_if_contains<Ys>{ys});
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            return detail::make_map_at(static_cast<Xs&&>(xs).storage,
+                detail::map_indices_if_contained<Xs, Ys, true>{});
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // difference
-    //////////////////////////////////////////////////////////////////////////
     template <>
     struct difference_impl<map_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            return detail::make_map_at(static_cast<Xs&&>(xs).storage,
+                detail::map_indices_if_contained<Xs, Ys, false>{});
+        }
+    };
+
+    template <>
+    struct symmetric_difference_impl<map_tag> {
+        // This is equivalent to
+        // `hana::union_(hana::difference(xs, ys), hana::difference(ys, xs))`,
+        // but no intermediate map is created.
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(
-                    hana::keys(static_cast<Ys&&>(ys)),
-                    static_cast<Xs&&>(xs),
-                    hana::erase_key);
+            using XsOnly = detail::map_indices_if_contained<Xs, Ys, false>;
+            using YsOnly = detail::map_indices_if_contained<Ys, Xs, false>;
+            return detail::map_merge(static_cast<Ys&&>(ys), YsOnly{},
+                                     static_cast<Xs&&>(xs), XsOnly{});
         }
     };
 
@@ -567,8 +641,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct to_impl<map_tag, F, when<hana::Foldable<F>::value>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold_left(
-                static_cast<Xs&&>(xs), hana::make_map(), hana::insert
+            return detail::make_map_from_storage(
+                hana::unpack(static_cast<Xs&&>(xs), hana::make_basic_tuple)
             );
         }
     };
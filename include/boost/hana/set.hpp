@@ -23,24 +23,26 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
-#include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/erase_key.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/find.hpp>
 #include <boost/hana/find_if.hpp>
-#include <boost/hana/fold_left.hpp>
 #include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 #include <boost/hana/fwd/difference.hpp>
 #include <boost/hana/fwd/intersection.hpp>
+#include <boost/hana/fwd/symmetric_difference.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/is_subset.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
-#include <boost/hana/remove.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
@@ -78,6 +80,87 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    namespace detail {
+        template <typename Storage>
+        struct ElementAtIndex {
+            template <std::size_t i>
+            using apply = decltype(hana::at_c<i>(std::declval<Storage>()));
+        };
+
+        // The `hash_table` indexing the elements of a set. Contrary to
+        // `hana::map`, the table is not part of the set's type; it is only
+        // computed (once per type of set) when a lookup is performed. The
+        // elements of a set are unique, but their hashes may collide.
+        template <typename Set>
+        struct set_hash_table;
+
+        template <typename ...Xs>
+        struct set_hash_table<hana::set<Xs...>> {
+            using type = typename detail::make_bulk_hash_table<
+                detail::ElementAtIndex<hana::tuple<Xs...>>::template apply,
+                sizeof...(Xs)
+            >::type;
+        };
+
+        template <typename Set, typename Key,
+                  bool = detail::decay<Set>::type::size == 0>
+        struct set_find_index {
+            using RawSet = typename detail::decay<Set>::type;
+            using type = typename detail::find_index<
+                typename detail::set_hash_table<RawSet>::type, Key,
+                detail::ElementAtIndex<decltype(std::declval<RawSet>().storage)>::template apply
+            >::type;
+        };
+
+        // Nothing can be found in an empty set; the key need not even be
+        // `Hashable` in that case.
+        template <typename Set, typename Key>
+        struct set_find_index<Set, Key, true> {
+            using type = hana::optional<>;
+        };
+
+        // Creates a set holding the elements at the given indices of a
+        // `hana::tuple`, which must all be different.
+        template <typename Xs, std::size_t ...i>
+        constexpr auto make_set_at(Xs&& xs, std::index_sequence<i...>) {
+            using Set = hana::set<typename detail::decay<
+                decltype(hana::at_c<i>(static_cast<Xs&&>(xs)))
+            >::type...>;
+            return Set{hana::make_tuple(hana::at_c<i>(static_cast<Xs&&>(xs))...)};
+        }
+
+        // Creates a set from a `hana::tuple` whose elements may not be
+        // unique, keeping only the first occurence of each element. This
+        // is equivalent to inserting the elements one by one, but the set
+        // is built in a single step.
+        template <typename Storage>
+        struct set_from_storage {
+            static constexpr std::size_t N = decltype(hana::length(std::declval<Storage>()))::value;
+            using Table = detail::make_bulk_hash_table<
+                detail::ElementAtIndex<Storage>::template apply, N
+            >;
+
+            template <typename Xs, typename Indices>
+            static constexpr auto apply(Xs&& xs, Indices indices)
+            { return detail::make_set_at(static_cast<Xs&&>(xs), indices); }
+
+            // All the elements were unique; use the storage as-is.
+            template <typename ...X>
+            static constexpr auto apply(hana::tuple<X...>&& xs, std::make_index_sequence<N>)
+            { return hana::set<X...>{static_cast<hana::tuple<X...>&&>(xs)}; }
+
+            template <typename Xs>
+            static constexpr auto apply(Xs&& xs)
+            { return apply(static_cast<Xs&&>(xs), typename Table::indices{}); }
+        };
+
+        template <typename Xs>
+        constexpr auto make_set_from_storage(Xs&& xs) {
+            using Storage = typename detail::decay<Xs>::type;
+            return detail::set_from_storage<Storage>::apply(static_cast<Xs&&>(xs));
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Operators
     //////////////////////////////////////////////////////////////////////////
@@ -108,7 +191,11 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_set(xs...) requires all the 'xs' to be "
             "Comparable at compile-time");
 
-            static_assert(!detail::has_duplicates<Xs&&...>::value,
+            static_assert(detail::make_bulk_hash_table<
+                detail::ElementAtIndex<
+                    hana::tuple<typename detail::decay<Xs>::type...>
+                >::template apply, sizeof...(Xs)
+            >::indices::size() == sizeof...(Xs),
             "hana::make_set(xs...) requires all the 'xs' to be unique");
 #endif
 
@@ -163,6 +250,35 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct find_impl<set_tag> {
+        template <typename Xs>
+        static constexpr auto find_helper(Xs&&, hana::optional<>) {
+            return hana::nothing;
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        find_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
+            return hana::just(hana::at_c<i>(static_cast<Xs&&>(xs).storage));
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs&& xs, Key const&) {
+            using MaybeIndex = typename detail::set_find_index<Xs, Key>::type;
+            return find_helper(static_cast<Xs&&>(xs), MaybeIndex{});
+        }
+    };
+
+    template <>
+    struct contains_impl<set_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const&, Key const&) {
+            using MaybeIndex = typename detail::set_find_index<Xs, Key>::type;
+            return hana::bool_<!decltype(hana::is_nothing(MaybeIndex{}))::value>{};
+        }
+    };
+
     template <>
     struct any_of_impl<set_tag> {
         template <typename Pred>
@@ -209,9 +325,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct to_impl<set_tag, F, when<hana::Foldable<F>::value>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold_left(static_cast<Xs&&>(xs),
-                                   hana::make_set(),
-                                   hana::insert);
+            return detail::make_set_from_storage(
+                hana::unpack(static_cast<Xs&&>(xs), hana::make_tuple)
+            );
         }
     };
 
@@ -229,9 +345,13 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename X, std::size_t ...n>
         static constexpr auto
         insert_helper(Xs&& xs, X&& x, hana::false_, std::index_sequence<n...>) {
-            return hana::make_set(
+            using Set = hana::set<
+                typename detail::decay<decltype(hana::at_c<n>(xs.storage))>::type...,
+                typename detail::decay<X>::type
+            >;
+            return Set{hana::make_tuple(
                 hana::at_c<n>(static_cast<Xs&&>(xs).storage)..., static_cast<X&&>(x)
-            );
+            )};
         }
 
         template <typename Xs, typename X>
@@ -248,74 +368,120 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<set_tag> {
+        template <typename Xs>
+        static constexpr auto erase_key_helper(Xs&& xs, ...) {
+            return static_cast<Xs&&>(xs);
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        erase_key_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
+            constexpr std::size_t size = std::remove_reference<Xs>::type::size;
+            return erase_at<i>(static_cast<Xs&&>(xs),
+                               std::make_index_sequence<i>{},
+                               std::make_index_sequence<size - i - 1>{});
+        }
+
+        template <std::size_t i, typename Xs, std::size_t ...before, std::size_t ...after>
+        static constexpr auto erase_at(Xs&& xs, std::index_sequence<before...>,
+                                                std::index_sequence<after...>)
+        {
+            return detail::make_set_at(static_cast<Xs&&>(xs).storage,
+                std::index_sequence<before..., (i + 1 + after)...>{});
+        }
+
         template <typename Xs, typename X>
-        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
-            return hana::unpack(
-                hana::remove(static_cast<Xs&&>(xs).storage,
-                             static_cast<X&&>(x)),
-                hana::make_set
-            );
+        static constexpr auto apply(Xs&& xs, X const&) {
+            using MaybeIndex = typename detail::set_find_index<Xs, X>::type;
+            return erase_key_helper(static_cast<Xs&&>(xs), MaybeIndex{});
         }
     };
 
     //////////////////////////////////////////////////////////////////////////
-    // intersection
+    // intersection, difference, union_ and symmetric_difference
     //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename Ys>
-        struct set_insert_if_contains {
-            Ys const& ys;
-
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&& key, hana::true_) {
-                return hana::insert(static_cast<Result&&>(result), static_cast<Key&&>(key));
-            }
-
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&&, hana::false_) {
-                return static_cast<Result&&>(result);
-            }
-
-            template <typename Result, typename Key>
-            constexpr auto operator()(Result&& result, Key&& key) const {
-                constexpr bool keep = hana::value<decltype(hana::contains(ys, key))>();
-                return set_insert_if_contains::helper(static_cast<Result&&>(result),
-                                                      static_cast<Key&&>(key),
-                                                      hana::bool_c<keep>);
-            }
+        // Computes the indices of the elements of a set that are (or are
+        // not, when `Keep` is false) contained in the set `Ys`. Each check
+        // is a lookup in the hash table of `Ys`, so this is linear in the
+        // size of both sets.
+        template <typename Ys, bool Keep>
+        struct set_filter_indices {
+            template <typename ...X>
+            constexpr auto operator()(X const& ...) const -> detail::filter_indices<
+                (decltype(hana::contains(std::declval<Ys const&>(),
+                                        std::declval<X const&>()))::value == Keep)...
+            > { return {}; }
         };
+
+        template <typename Xs, typename Ys, bool Keep>
+        using set_indices_if_contained = typename detail::cached_index_sequence<
+            decltype(hana::unpack(std::declval<Xs>().storage, detail::set_filter_indices<
+                typename detail::decay<Ys>::type, Keep
+            >{}))
+        >::type;
+
+        // Creates a set holding the elements at the given indices of `xs`,
+        // followed by the elements at the given indices of `ys`. None of
+        // these elements may be equal, so the set is built in a single step.
+        template <typename Xs, typename Ys, std::size_t ...i, std::size_t ...j>
+        constexpr auto set_merge(Xs&& xs, std::index_sequence<i...>,
+                                 Ys&& ys, std::index_sequence<j...>)
+        {
+            using Set = hana::set<
+                typename detail::decay<decltype(hana::at_c<i>(xs.storage))>::type...,
+                typename detail::decay<decltype(hana::at_c<j>(ys.storage))>::type...
+            >;
+            return Set{hana::make_tuple(
+                hana::at_c<i>(static_cast<Xs&&>(xs).storage)...,
+                hana::at_c<j>(static_cast<Ys&&>(ys).storage)...
+            )};
+        }
     }
 
     template <>
     struct intersection_impl<set_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys const& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), hana::make_set(),
-                                   detail::set_insert_if_contains<Ys>{ys});
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            return detail::make_set_at(static_cast<Xs&&>(xs).storage,
+                detail::set_indices_if_contained<Xs, Ys, true>{});
+        }
+    };
+
+    template <>
+    struct difference_impl<set_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            return detail::make_set_at(static_cast<Xs&&>(xs).storage,
+                detail::set_indices_if_contained<Xs, Ys, false>{});
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // union_
-    //////////////////////////////////////////////////////////////////////////
     template <>
     struct union_impl<set_tag> {
+        // This is equivalent to `hana::fold_left(xs, ys, hana::insert)`,
+        // but the resulting set is built in a single step.
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
-                                   hana::insert);
+            constexpr std::size_t size = detail::decay<Ys>::type::size;
+            return detail::set_merge(
+                static_cast<Ys&&>(ys), std::make_index_sequence<size>{},
+                static_cast<Xs&&>(xs), detail::set_indices_if_contained<Xs, Ys, false>{}
+            );
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // difference
-    //////////////////////////////////////////////////////////////////////////
     template <>
-    struct difference_impl<set_tag> {
+    struct symmetric_difference_impl<set_tag> {
+        // This is equivalent to
+        // `hana::union_(hana::difference(xs, ys), hana::difference(ys, xs))`,
+        // but no intermediate set is created.
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Ys&&>(ys), static_cast<Xs&&>(xs),
-                                   hana::erase_key);
+            using XsOnly = detail::set_indices_if_contained<Xs, Ys, false>;
+            using YsOnly = detail::set_indices_if_contained<Ys, Xs, false>;
+            return detail::set_merge(static_cast<Ys&&>(ys), YsOnly{},
+                                     static_cast<Xs&&>(xs), XsOnly{});
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -13,14 +13,28 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/sort.hpp>
 
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
+#include <boost/hana/detail/std_common_type.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/functional/id.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/less.hpp>
+#include <boost/hana/ordering.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/value.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <utility> // std::declval, std::index_sequence
 
 
@@ -244,6 +258,121 @@ BOOST_HANA_NAMESPACE_BEGIN
         struct merge_sort_impl<Pred, std::index_sequence<>> {
             using type = std::index_sequence<>;
         };
+
+        // When sorting with `hana::less` or `hana::ordering(key)` and the
+        // elements (or their keys) are `IntegralConstant`s, only the values
+        // of the constants need to be compared. Hence, the sorted permutation
+        // is computed by sorting the values in a single constexpr function,
+        // instead of instantiating the predicate for each comparison. Each
+        // key is computed exactly once, in `make_value_sort`.
+        template <typename ...X>
+        struct value_sort {
+            static constexpr bool value = sizeof...(X) > 1 && detail::fast_and<
+                hana::IntegralConstant<X>::value...
+            >::value;
+        };
+
+        template <typename Key>
+        struct make_value_sort {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...) const -> value_sort<typename detail::decay<
+                decltype(std::declval<Key const&>()(std::declval<X>()))
+            >::type...>
+            { return {}; }
+        };
+
+        template <typename T>
+        struct value_sort_entry {
+            T value;
+            std::size_t index;
+        };
+
+        struct value_sort_less {
+            template <typename T>
+            constexpr bool operator()(T const& a, T const& b) const
+            { return a.value < b.value; }
+        };
+
+        template <typename ValueSort>
+        struct value_sort_indices;
+
+        template <typename ...X>
+        struct value_sort_indices<value_sort<X...>> {
+            template <std::size_t ...i>
+            static constexpr auto compute_indices(std::index_sequence<i...>) {
+                using Value = typename detail::type_foldl1<detail::std_common_type,
+                    typename detail::decay<decltype(hana::value<X>())>::type...
+                >::type;
+                using Entry = value_sort_entry<Value>;
+                detail::array<Entry, sizeof...(X)> entries{{
+                    Entry{static_cast<Value>(hana::value<X>()), i}...
+                }};
+                auto sorted = entries.stable_sort(value_sort_less{});
+                detail::array<std::size_t, sizeof...(X)> indices{};
+                for (std::size_t n = 0; n < sizeof...(X); ++n)
+                    indices[n] = sorted[n].index;
+                return indices;
+            }
+
+            static constexpr auto cached_indices =
+                compute_indices(std::index_sequence_for<X...>{});
+        };
+
+        template <typename Xs, typename Pred, typename Indices>
+        struct merge_sort_indices {
+            using type = typename merge_sort_impl<
+                sort_predicate<Xs, Pred>, Indices
+            >::type;
+        };
+
+        template <typename Xs, typename Pred, typename Indices>
+        struct sort_indices
+            : merge_sort_indices<Xs, Pred, Indices>
+        { };
+
+        // When the keys are not all `IntegralConstant`s, the indices are
+        // merge sorted by comparing the keys computed by `make_value_sort`
+        // with `hana::less`, so each key is still computed once instead of
+        // twice per comparison.
+        template <typename ValueSort, typename Indices>
+        struct key_sort_indices;
+
+        template <typename ...K, typename Indices>
+        struct key_sort_indices<value_sort<K...>, Indices> {
+            using type = typename merge_sort_impl<
+                sort_predicate<hana::basic_tuple<K...>, hana::less_t>, Indices
+            >::type;
+        };
+
+        template <typename Xs, typename Pred, typename Key, typename Indices,
+                  typename ValueSort = decltype(
+                    hana::unpack(std::declval<Xs>(), make_value_sort<Key>{})
+                  ),
+                  bool = ValueSort::value>
+        struct sort_indices_by_value
+            : merge_sort_indices<Xs, Pred, Indices>
+        { };
+
+        template <typename Xs, typename Pred, typename Key, typename Indices,
+                  typename ValueSort>
+        struct sort_indices_by_value<Xs, Pred, Key, Indices, ValueSort, true>
+            : cached_index_sequence<value_sort_indices<ValueSort>>
+        { };
+
+        template <typename Xs, typename F, typename Indices, typename ValueSort>
+        struct sort_indices_by_value<Xs, detail::less_by<F>, F, Indices, ValueSort, false>
+            : key_sort_indices<ValueSort, Indices>
+        { };
+
+        template <typename Xs, typename Indices>
+        struct sort_indices<Xs, hana::less_t, Indices>
+            : sort_indices_by_value<Xs, hana::less_t, hana::id_t, Indices>
+        { };
+
+        template <typename Xs, typename F, typename Indices>
+        struct sort_indices<Xs, detail::less_by<F>, Indices>
+            : sort_indices_by_value<Xs, detail::less_by<F>, F, Indices>
+        { };
     } // end namespace detail
 
     template <typename S, bool condition>
@@ -256,9 +385,8 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred const&) {
             constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            using Indices = typename detail::merge_sort_impl<
-                detail::sort_predicate<Xs&&, Pred>,
-                std::make_index_sequence<Len>
+            using Indices = typename detail::sort_indices<
+                Xs&&, Pred, std::make_index_sequence<Len>
             >::type;
 
             return apply_impl(static_cast<Xs&&>(xs), Indices{});
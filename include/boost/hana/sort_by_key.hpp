@@ -0,0 +1,73 @@
+/*!
+@file
+Defines `boost::hana::sort_by_key`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_SORT_BY_KEY_HPP
+#define BOOST_HANA_SORT_BY_KEY_HPP
+
+#include <boost/hana/fwd/sort_by_key.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/ordering.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename Key>
+    constexpr auto sort_by_key_t::operator()(Xs&& xs, Key&& key) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using SortByKey = BOOST_HANA_DISPATCH_IF(sort_by_key_impl<S>,
+            hana::Sequence<S>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Sequence<S>::value,
+        "hana::sort_by_key(xs, key) requires 'xs' to be a Sequence");
+    #endif
+
+        return SortByKey::apply(static_cast<Xs&&>(xs), static_cast<Key&&>(key));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct sort_by_key_impl<S, when<condition>> : default_ {
+        template <typename Xs, std::size_t ...i>
+        static constexpr auto apply_impl(Xs&& xs, std::index_sequence<i...>) {
+            return hana::make_pair(
+                hana::make<S>(hana::at_c<i>(static_cast<Xs&&>(xs))...),
+                hana::make_tuple(hana::size_c<i>...)
+            );
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs&& xs, Key const&) {
+            constexpr std::size_t Len = decltype(hana::length(xs))::value;
+            using Indices = typename detail::sort_indices<
+                Xs&&, detail::less_by<typename detail::decay<Key>::type>,
+                std::make_index_sequence<Len>
+            >::type;
+
+            return apply_impl(static_cast<Xs&&>(xs), Indices{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_SORT_BY_KEY_HPP
@@ -18,10 +18,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/fwd/adjust_if.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -51,6 +57,52 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace detail {
+        template <typename S, typename U, typename Indices>
+        struct transform_result;
+
+        template <typename S, typename U, std::size_t ...i>
+        struct transform_result<S, U, std::index_sequence<i...>> {
+            using type = decltype(hana::make<S>(
+                (static_cast<void>(i), std::declval<U>())...
+            ));
+        };
+
+        // The result can be filled by a loop when it is made of elements of
+        // a single type `U` stored contiguously, which we can default
+        // construct and then assign.
+        template <typename Result, typename U, typename Storage = homogeneous_storage<Result>,
+                  bool = Storage::value>
+        struct transform_fillable {
+            static constexpr bool value = false;
+        };
+
+        template <typename Result, typename U, typename Storage>
+        struct transform_fillable<Result, U, Storage, true> {
+            static constexpr bool value =
+                std::is_same<decltype(Storage::data(std::declval<Result&>())), U*>::value &&
+                std::is_default_constructible<U>::value &&
+                std::is_move_assignable<U>::value;
+        };
+
+        template <typename S, typename Xs, typename F, bool = use_loop<Xs>::value>
+        struct transform_loop {
+            static constexpr bool value = false;
+        };
+
+        template <typename S, typename Xs, typename F>
+        struct transform_loop<S, Xs, F, true> {
+            using Elements = homogeneous_elements<Xs>;
+            using U = typename detail::decay<
+                decltype(std::declval<F&>()(std::declval<typename Elements::reference>()))
+            >::type;
+            using Result = typename transform_result<
+                S, U, std::make_index_sequence<Elements::size>
+            >::type;
+            static constexpr bool value = transform_fillable<Result, U>::value;
+        };
+    }
+
     template <typename S>
     struct transform_impl<S, when<Sequence<S>::value>> {
         //! @cond
@@ -65,11 +117,28 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! @endcond
 
         template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F&& f) {
+        static constexpr auto apply_impl(Xs&& xs, F&& f, hana::false_) {
             // We use a pointer to workaround a Clang 3.5 ICE
             return hana::unpack(static_cast<Xs&&>(xs),
                                 transformer<decltype(&f)>{&f});
         }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply_impl(Xs&& xs, F&& f, hana::true_) {
+            using Result = typename detail::transform_loop<S, Xs, F>::Result;
+            detail::homogeneous_elements<Xs> e{xs};
+            Result result{};
+            auto out = detail::homogeneous_storage<Result>::data(result);
+            for (std::size_t i = 0; i != e.size; ++i)
+                out[i] = f(e[i]);
+            return result;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                              hana::bool_c<detail::transform_loop<S, Xs, F>::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
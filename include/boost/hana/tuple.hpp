@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/homogeneous_storage.hpp>
 #include <boost/hana/detail/index_if.hpp>
 #include <boost/hana/detail/intrinsics.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
@@ -213,6 +214,28 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
+    namespace detail {
+        template <typename Storage, bool = Storage::value>
+        struct tuple_homogeneous_storage {
+            static constexpr bool value = false;
+        };
+
+        template <typename Storage>
+        struct tuple_homogeneous_storage<Storage, true> {
+            static constexpr bool value = true;
+            static constexpr std::size_t size = Storage::size;
+
+            template <typename Xs>
+            static constexpr auto data(Xs& xs)
+            { return Storage::data(xs.storage_); }
+        };
+
+        template <typename ...Xn>
+        struct homogeneous_storage<tuple<Xn...>>
+            : tuple_homogeneous_storage<homogeneous_storage<basic_tuple<Xn...>>>
+        { };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
@@ -8,15 +8,21 @@
 #include <boost/hana/all_of.hpp>
 #include <boost/hana/assert.hpp>
 #include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/less.hpp>
+#include <boost/hana/negate.hpp>
+#include <boost/hana/ordering.hpp>
 #include <boost/hana/permutations.hpp>
 #include <boost/hana/sort.hpp>
 #include <boost/hana/transform.hpp>
+#include <boost/hana/type.hpp>
 
 #include "test_case.hpp"
 #include <laws/base.hpp>
 #include <support/equivalence_class.hpp>
 
+#include <type_traits>
+
 
 TestCase test_sort{[]{
     namespace hana = boost::hana;
@@ -51,6 +57,52 @@ TestCase test_sort{[]{
         ));
     }
 
+    // Test with IntegralConstants, which are sorted by value
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(MAKE_TUPLE(hana::int_c<3>, hana::long_c<-1>, hana::int_c<2>)),
+            MAKE_TUPLE(hana::long_c<-1>, hana::int_c<2>, hana::int_c<3>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(MAKE_TUPLE(hana::int_c<2>, hana::char_c<1>, hana::int_c<0>,
+                                  hana::size_c<4>, hana::int_c<3>)),
+            MAKE_TUPLE(hana::int_c<0>, hana::char_c<1>, hana::int_c<2>,
+                       hana::int_c<3>, hana::size_c<4>)
+        ));
+
+        // check stability
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::transform(
+                hana::sort(MAKE_TUPLE(hana::int_c<2>, hana::long_c<1>,
+                                      hana::int_c<1>, hana::long_c<2>)),
+                hana::typeid_
+            ),
+            MAKE_TUPLE(hana::type_c<hana::long_<1>>, hana::type_c<hana::int_<1>>,
+                       hana::type_c<hana::int_<2>>, hana::type_c<hana::long_<2>>)
+        ));
+
+        // with hana::ordering, the keys are sorted by value too
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(MAKE_TUPLE(hana::int_c<2>, hana::int_c<-1>, hana::int_c<3>),
+                       hana::ordering(hana::negate)),
+            MAKE_TUPLE(hana::int_c<3>, hana::int_c<2>, hana::int_c<-1>)
+        ));
+
+        // with hana::ordering on local types
+        {
+            struct A { using key = hana::int_<1>; };
+            struct B { using key = hana::int_<0>; };
+            auto key = [](auto const& a) {
+                return typename std::decay<decltype(a)>::type::key{};
+            };
+            BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                hana::transform(hana::sort(MAKE_TUPLE(A{}, B{}), hana::ordering(key)),
+                                hana::typeid_),
+                MAKE_TUPLE(hana::type_c<B>, hana::type_c<A>)
+            ));
+        }
+    }
+
     // Test with a custom predicate
     {
         auto pred = [](auto x, auto y) {
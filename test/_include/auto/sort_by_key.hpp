@@ -0,0 +1,105 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_SORT_BY_KEY_HPP
+#define BOOST_HANA_TEST_AUTO_SORT_BY_KEY_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/sort_by_key.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+
+#include <type_traits>
+
+
+namespace _test_sort_by_key {
+    template <int i>
+    using x = boost::hana::test::ct_eq<i>;
+
+    // Key returning an IntegralConstant, which is sorted by value.
+    struct value_key {
+        template <int i>
+        constexpr auto operator()(x<i>) const { return boost::hana::int_c<i / 10>; }
+    };
+
+    // Key returning a compile-time Orderable which is not an IntegralConstant.
+    struct ord_key {
+        template <int i>
+        constexpr auto operator()(x<i>) const { return boost::hana::test::ct_ord<i / 10>{}; }
+    };
+}
+
+TestCase test_sort_by_key{[]{
+    namespace hana = boost::hana;
+    using _test_sort_by_key::x;
+
+    auto check = [](auto key) {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(), key),
+            hana::make_pair(MAKE_TUPLE(), hana::make_tuple())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(x<0>{}), key),
+            hana::make_pair(MAKE_TUPLE(x<0>{}), hana::make_tuple(hana::size_c<0>))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(x<10>{}, x<0>{}), key),
+            hana::make_pair(MAKE_TUPLE(x<0>{}, x<10>{}),
+                            hana::make_tuple(hana::size_c<1>, hana::size_c<0>))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(x<20>{}, x<0>{}, x<40>{}, x<-10>{}), key),
+            hana::make_pair(MAKE_TUPLE(x<-10>{}, x<0>{}, x<20>{}, x<40>{}),
+                            hana::make_tuple(hana::size_c<3>, hana::size_c<1>,
+                                             hana::size_c<0>, hana::size_c<2>))
+        ));
+
+        // check stability
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(x<11>{}, x<10>{}), key),
+            hana::make_pair(MAKE_TUPLE(x<11>{}, x<10>{}),
+                            hana::make_tuple(hana::size_c<0>, hana::size_c<1>))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort_by_key(MAKE_TUPLE(x<21>{}, x<11>{}, x<20>{}, x<10>{}, x<12>{}), key),
+            hana::make_pair(MAKE_TUPLE(x<11>{}, x<10>{}, x<12>{}, x<21>{}, x<20>{}),
+                            hana::make_tuple(hana::size_c<1>, hana::size_c<3>, hana::size_c<4>,
+                                             hana::size_c<0>, hana::size_c<2>))
+        ));
+    };
+
+    check(_test_sort_by_key::value_key{});
+    check(_test_sort_by_key::ord_key{});
+
+    // check with local types
+    {
+        struct A { using key = hana::int_<1>; };
+        struct B { using key = hana::int_<0>; };
+        auto key = [](auto const& a) {
+            return typename std::decay<decltype(a)>::type::key{};
+        };
+
+        auto sorted = hana::sort_by_key(MAKE_TUPLE(A{}, B{}), key);
+        static_assert(std::is_same<
+            decltype(hana::at_c<0>(hana::first(sorted))), B&
+        >::value, "");
+        static_assert(std::is_same<
+            decltype(hana::at_c<1>(hana::first(sorted))), A&
+        >::value, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::second(sorted),
+            hana::make_tuple(hana::size_c<1>, hana::size_c<0>)
+        ));
+    }
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_SORT_BY_KEY_HPP
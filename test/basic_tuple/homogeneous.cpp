@@ -0,0 +1,126 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// Tuples whose elements all have the same type are stored in an array, which
+// must not change their behavior.
+
+struct empty { };
+
+// trivially copyable, but only through its move constructor
+struct move_only_int {
+    constexpr move_only_int(int v) : value(v) { }
+    move_only_int(move_only_int&&) = default;
+    move_only_int(move_only_int const&) = delete;
+    int value;
+};
+
+struct explicit_int {
+    explicit constexpr explicit_int(int v) : value(v) { }
+    int value;
+};
+
+int main() {
+    // the elements are stored contiguously
+    {
+        using Tuple = hana::basic_tuple<double, double, double>;
+        static_assert(sizeof(Tuple) == sizeof(double[3]), "");
+
+        Tuple xs{1.0, 2.0, 3.0};
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_c<1>(xs) == &hana::at_c<0>(xs) + 1);
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_c<2>(xs) == &hana::at_c<0>(xs) + 2);
+    }
+
+    // access
+    {
+        hana::basic_tuple<int, int, int> xs{1, 2, 3};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at(xs, hana::size_c<1>) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs) == 3);
+
+        hana::at_c<1>(xs) = 20;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 20);
+
+        static_assert(std::is_same<decltype(hana::at_c<0>(xs)), int&>{}, "");
+        static_assert(std::is_same<decltype(hana::at_c<0>(std::move(xs))), int&&>{}, "");
+        auto const& cxs = xs;
+        static_assert(std::is_same<decltype(hana::at_c<0>(cxs)), int const&>{}, "");
+    }
+
+    // unpack, transform and drop_front
+    {
+        hana::basic_tuple<int, int, int> xs{1, 2, 3};
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(xs, [](int a, int b, int c) {
+            return a == 1 && b == 2 && c == 3;
+        }));
+        hana::unpack(xs, [](int& a, int&, int&) { a = 10; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 10);
+        hana::unpack(std::move(xs), [](auto&& a, auto&&, auto&&) {
+            static_assert(std::is_rvalue_reference<decltype(a)>{}, "");
+        });
+
+        auto ys = hana::transform(xs, [](int x) { return x * 2; });
+        static_assert(std::is_same<decltype(ys), hana::basic_tuple<int, int, int>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 20);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(ys) == 6);
+
+        auto zs = hana::drop_front(xs, hana::size_c<1>);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(zs) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(zs) == 3);
+    }
+
+    // constexpr construction and copies
+    {
+        constexpr hana::basic_tuple<long, long> xs{1, 2};
+        constexpr hana::basic_tuple<long, long> ys = xs;
+        static_assert(hana::at_c<0>(ys) == 1, "");
+        static_assert(hana::at_c<1>(ys) == 2, "");
+
+        constexpr hana::basic_tuple<long, long> zs{};
+        static_assert(hana::at_c<0>(zs) == 0, "");
+    }
+
+    // the elements are direct-initialized
+    {
+        hana::basic_tuple<explicit_int, explicit_int> xs{1, 2};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs).value == 2);
+    }
+
+    // the elements are moved from rvalues
+    {
+        static_assert(std::is_trivially_copyable<move_only_int>{}, "");
+        hana::basic_tuple<move_only_int, move_only_int> xs{1, 2};
+        hana::basic_tuple<move_only_int, move_only_int> ys{std::move(xs)};
+        hana::basic_tuple<move_only_int, move_only_int> zs = std::move(ys);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(zs).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(zs).value == 2);
+    }
+
+    // other types are still stored as before
+    {
+        static_assert(sizeof(hana::basic_tuple<empty, empty>) <= 2, "");
+
+        hana::basic_tuple<std::string, std::string> xs{"abc", "def"};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == "def");
+
+        hana::basic_tuple<std::unique_ptr<int>, std::unique_ptr<int>> ys{
+            std::make_unique<int>(1), std::make_unique<int>(2)
+        };
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<1>(ys) == 2);
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+template <int i = 0>
+struct undefined { };
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age)
+    );
+};
+
+// Counts the copies and moves of the objects it is copied or moved from.
+struct counted {
+    int* count;
+    explicit counted(int* c) : count(c) { }
+    counted(counted const& other) : count(other.count) { ++*count; }
+    counted(counted&& other) : count(other.count) { ++*count; }
+};
+
+struct Counted {
+    BOOST_HANA_DEFINE_STRUCT(Counted,
+        (counted, a),
+        (counted, b)
+    );
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(), hana::int_c<0>),
+        hana::nothing
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(ct_eq<0>{}), hana::int_c<0>),
+        hana::just(ct_eq<0>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(undefined<0>{}), hana::int_c<1>),
+        hana::nothing
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), hana::int_c<1>),
+        hana::just(ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), hana::long_c<2>),
+        hana::just(ct_eq<2>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(undefined<0>{}, undefined<1>{}), hana::int_c<2>),
+        hana::nothing
+    ));
+
+    // keys that are not Hashable are compared with every member's name
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(ct_eq<0>{}, ct_eq<1>{}), ct_eq<1>{}),
+        hana::just(ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(obj(undefined<0>{}, undefined<1>{}), ct_eq<2>{}),
+        hana::nothing
+    ));
+
+    // members looked up by name
+    {
+        Person john{"John", "Doe", 30};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::find(john, BOOST_HANA_STRING("last_name")) == hana::just(std::string{"Doe"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::find(john, BOOST_HANA_STRING("age")) == hana::just(30)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(john, BOOST_HANA_STRING("nickname")),
+            hana::nothing
+        ));
+
+        int& age = hana::at_key(john, BOOST_HANA_STRING("age"));
+        age = 31;
+        BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+    }
+
+    // only the member that is found is copied or moved
+    {
+        int a = 0, b = 0;
+        Counted c{counted{&a}, counted{&b}};
+        a = b = 0;
+
+        auto found = hana::find(c, BOOST_HANA_STRING("b"));
+        BOOST_HANA_RUNTIME_CHECK(a == 0);
+        BOOST_HANA_RUNTIME_CHECK(found.value().count == &b);
+
+        hana::find(std::move(c), BOOST_HANA_STRING("b"));
+        BOOST_HANA_RUNTIME_CHECK(a == 0);
+    }
+}
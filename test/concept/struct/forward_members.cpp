@@ -0,0 +1,116 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/forward_members.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/zip.hpp>
+#include <boost/hana/zip_with.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct MoveOnly {
+    MoveOnly()                           = default;
+    MoveOnly(MoveOnly&&)                 = default;
+    MoveOnly(MoveOnly const&)            = delete;
+    MoveOnly& operator=(MoveOnly&&)      = default;
+    MoveOnly& operator=(MoveOnly const&) = delete;
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::forward_members(obj()),
+        ::seq()
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::forward_members(obj(ct_eq<0>{})),
+        ::seq(ct_eq<0>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::forward_members(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})),
+        ::seq(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+    ));
+
+    // make sure the members are referred to, not copied
+    {
+        Person john{"John", 30};
+        auto refs = hana::forward_members(john);
+        static_assert(std::is_same<
+            decltype(refs), hana::tuple<std::string&, int&>
+        >{}, "");
+        hana::at_c<0>(refs) = "Bob";
+        hana::at_c<1>(refs) = 99;
+        BOOST_HANA_RUNTIME_CHECK(john.name == "Bob");
+        BOOST_HANA_RUNTIME_CHECK(john.age == 99);
+
+        Person const& const_john = john;
+        static_assert(std::is_same<
+            decltype(hana::forward_members(const_john)),
+            hana::tuple<std::string const&, int const&>
+        >{}, "");
+
+        static_assert(std::is_same<
+            decltype(hana::forward_members(std::move(john))),
+            hana::tuple<std::string&&, int&&>
+        >{}, "");
+    }
+
+    // make sure it works with algorithms on Sequences
+    {
+        Person john{"John", 30};
+        hana::for_each(hana::forward_members(john), [](auto& member) {
+            member += member;
+        });
+        BOOST_HANA_RUNTIME_CHECK(john.name == "JohnJohn");
+        BOOST_HANA_RUNTIME_CHECK(john.age == 60);
+
+        Person bob{"Bob", 1};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::zip(hana::forward_members(john), hana::forward_members(bob)) ==
+            hana::make_tuple(hana::make_tuple("JohnJohn", "Bob"), hana::make_tuple(60, 1))
+        );
+
+        hana::zip_with([](auto const& from, auto& to) {
+            to = from;
+            return 0;
+        }, hana::forward_members(john), hana::forward_members(bob));
+        BOOST_HANA_RUNTIME_CHECK(bob.name == "JohnJohn");
+        BOOST_HANA_RUNTIME_CHECK(bob.age == 60);
+    }
+
+    // make sure it works with move only types
+    {
+        auto o = obj(MoveOnly{}, MoveOnly{});
+        auto refs = hana::forward_members(o);
+        MoveOnly m = std::move(hana::at_c<0>(refs));
+        (void)m;
+
+        auto rrefs = hana::forward_members(std::move(o));
+        MoveOnly n = hana::at_c<1>(std::move(rrefs));
+        (void)n;
+    }
+}
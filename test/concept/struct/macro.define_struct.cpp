@@ -6,6 +6,7 @@
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/contains.hpp>
 #include <boost/hana/define_struct.hpp>
+#include <boost/hana/not.hpp>
 #include <boost/hana/string.hpp>
 
 #include <laws/base.hpp>
@@ -40,10 +41,273 @@ struct Data3 {
     );
 };
 
+// This makes sure that we can define structs with up to 256 members.
+struct Data256 {
+    BOOST_HANA_DEFINE_STRUCT(Data256,
+        (int, m1),
+        (int, m2),
+        (int, m3),
+        (int, m4),
+        (int, m5),
+        (int, m6),
+        (int, m7),
+        (int, m8),
+        (int, m9),
+        (int, m10),
+        (int, m11),
+        (int, m12),
+        (int, m13),
+        (int, m14),
+        (int, m15),
+        (int, m16),
+        (int, m17),
+        (int, m18),
+        (int, m19),
+        (int, m20),
+        (int, m21),
+        (int, m22),
+        (int, m23),
+        (int, m24),
+        (int, m25),
+        (int, m26),
+        (int, m27),
+        (int, m28),
+        (int, m29),
+        (int, m30),
+        (int, m31),
+        (int, m32),
+        (int, m33),
+        (int, m34),
+        (int, m35),
+        (int, m36),
+        (int, m37),
+        (int, m38),
+        (int, m39),
+        (int, m40),
+        (int, m41),
+        (int, m42),
+        (int, m43),
+        (int, m44),
+        (int, m45),
+        (int, m46),
+        (int, m47),
+        (int, m48),
+        (int, m49),
+        (int, m50),
+        (int, m51),
+        (int, m52),
+        (int, m53),
+        (int, m54),
+        (int, m55),
+        (int, m56),
+        (int, m57),
+        (int, m58),
+        (int, m59),
+        (int, m60),
+        (int, m61),
+        (int, m62),
+        (int, m63),
+        (int, m64),
+        (int, m65),
+        (int, m66),
+        (int, m67),
+        (int, m68),
+        (int, m69),
+        (int, m70),
+        (int, m71),
+        (int, m72),
+        (int, m73),
+        (int, m74),
+        (int, m75),
+        (int, m76),
+        (int, m77),
+        (int, m78),
+        (int, m79),
+        (int, m80),
+        (int, m81),
+        (int, m82),
+        (int, m83),
+        (int, m84),
+        (int, m85),
+        (int, m86),
+        (int, m87),
+        (int, m88),
+        (int, m89),
+        (int, m90),
+        (int, m91),
+        (int, m92),
+        (int, m93),
+        (int, m94),
+        (int, m95),
+        (int, m96),
+        (int, m97),
+        (int, m98),
+        (int, m99),
+        (int, m100),
+        (int, m101),
+        (int, m102),
+        (int, m103),
+        (int, m104),
+        (int, m105),
+        (int, m106),
+        (int, m107),
+        (int, m108),
+        (int, m109),
+        (int, m110),
+        (int, m111),
+        (int, m112),
+        (int, m113),
+        (int, m114),
+        (int, m115),
+        (int, m116),
+        (int, m117),
+        (int, m118),
+        (int, m119),
+        (int, m120),
+        (int, m121),
+        (int, m122),
+        (int, m123),
+        (int, m124),
+        (int, m125),
+        (int, m126),
+        (int, m127),
+        (int, m128),
+        (int, m129),
+        (int, m130),
+        (int, m131),
+        (int, m132),
+        (int, m133),
+        (int, m134),
+        (int, m135),
+        (int, m136),
+        (int, m137),
+        (int, m138),
+        (int, m139),
+        (int, m140),
+        (int, m141),
+        (int, m142),
+        (int, m143),
+        (int, m144),
+        (int, m145),
+        (int, m146),
+        (int, m147),
+        (int, m148),
+        (int, m149),
+        (int, m150),
+        (int, m151),
+        (int, m152),
+        (int, m153),
+        (int, m154),
+        (int, m155),
+        (int, m156),
+        (int, m157),
+        (int, m158),
+        (int, m159),
+        (int, m160),
+        (int, m161),
+        (int, m162),
+        (int, m163),
+        (int, m164),
+        (int, m165),
+        (int, m166),
+        (int, m167),
+        (int, m168),
+        (int, m169),
+        (int, m170),
+        (int, m171),
+        (int, m172),
+        (int, m173),
+        (int, m174),
+        (int, m175),
+        (int, m176),
+        (int, m177),
+        (int, m178),
+        (int, m179),
+        (int, m180),
+        (int, m181),
+        (int, m182),
+        (int, m183),
+        (int, m184),
+        (int, m185),
+        (int, m186),
+        (int, m187),
+        (int, m188),
+        (int, m189),
+        (int, m190),
+        (int, m191),
+        (int, m192),
+        (int, m193),
+        (int, m194),
+        (int, m195),
+        (int, m196),
+        (int, m197),
+        (int, m198),
+        (int, m199),
+        (int, m200),
+        (int, m201),
+        (int, m202),
+        (int, m203),
+        (int, m204),
+        (int, m205),
+        (int, m206),
+        (int, m207),
+        (int, m208),
+        (int, m209),
+        (int, m210),
+        (int, m211),
+        (int, m212),
+        (int, m213),
+        (int, m214),
+        (int, m215),
+        (int, m216),
+        (int, m217),
+        (int, m218),
+        (int, m219),
+        (int, m220),
+        (int, m221),
+        (int, m222),
+        (int, m223),
+        (int, m224),
+        (int, m225),
+        (int, m226),
+        (int, m227),
+        (int, m228),
+        (int, m229),
+        (int, m230),
+        (int, m231),
+        (int, m232),
+        (int, m233),
+        (int, m234),
+        (int, m235),
+        (int, m236),
+        (int, m237),
+        (int, m238),
+        (int, m239),
+        (int, m240),
+        (int, m241),
+        (int, m242),
+        (int, m243),
+        (int, m244),
+        (int, m245),
+        (int, m246),
+        (int, m247),
+        (int, m248),
+        (int, m249),
+        (int, m250),
+        (int, m251),
+        (int, m252),
+        (int, m253),
+        (int, m254),
+        (int, m255),
+        (int, m256)
+    );
+};
+
 static_assert(hana::Struct<Data0>::value, "");
 static_assert(hana::Struct<Data1>::value, "");
 static_assert(hana::Struct<Data2>::value, "");
 static_assert(hana::Struct<Data3>::value, "");
+static_assert(hana::Struct<Data256>::value, "");
 
 int main() {
     BOOST_HANA_CONSTANT_CHECK(hana::contains(Data1{}, BOOST_HANA_STRING("member1")));
@@ -54,4 +318,8 @@ int main() {
     BOOST_HANA_CONSTANT_CHECK(hana::contains(Data3{}, BOOST_HANA_STRING("member1")));
     BOOST_HANA_CONSTANT_CHECK(hana::contains(Data3{}, BOOST_HANA_STRING("member2")));
     BOOST_HANA_CONSTANT_CHECK(hana::contains(Data3{}, BOOST_HANA_STRING("member3")));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(Data256{}, BOOST_HANA_STRING("m1")));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(Data256{}, BOOST_HANA_STRING("m256")));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(Data256{}, BOOST_HANA_STRING("m257"))));
 }
@@ -36,6 +36,10 @@ constexpr bool constexpr_context() {
     hana::detail::sort(first, last, hana::equal);
     hana::detail::sort(first, last);
 
+    int buffer[6] = {};
+    hana::detail::merge_ranges(first, first + 3, first + 3, last, buffer, hana::less);
+    hana::detail::stable_sort(first, last, buffer, hana::less);
+
     hana::detail::find(first, last, 3);
     hana::detail::find_if(first, last, hana::equal.to(3));
 
@@ -53,4 +57,23 @@ constexpr bool constexpr_context() {
 
 static_assert(constexpr_context(), "");
 
+// stable_sort is not taken from cppreference, so we also check its result.
+struct entry { int key; int tag; };
+struct key_less {
+    constexpr bool operator()(entry a, entry b) const { return a.key < b.key; }
+};
+
+constexpr bool stable_sort_is_stable() {
+    entry array[7] = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}, {0, 5}, {2, 6}};
+    entry buffer[7] = {};
+    hana::detail::stable_sort(array, array + 7, buffer, key_less{});
+    int expected[7] = {5, 1, 4, 3, 6, 0, 2};
+    for (int i = 0; i < 7; ++i)
+        if (array[i].tag != expected[i])
+            return false;
+    return true;
+}
+
+static_assert(stable_sort_is_stable(), "");
+
 int main() { }
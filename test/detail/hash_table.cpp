@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/detail/hash_table.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+using Table = hana::detail::direct_table<long long, 3, 0, hana::detail::no_slot, 1>;
+
+using Layout = hana::detail::direct_table_layout<
+    std::integer_sequence<long long, 5, 3, 4>,
+    std::index_sequence<0, 1, 2>
+>;
+
+using ToHashTable = hana::detail::direct_to_hash_table<
+    Table, std::index_sequence<0, 1>
+>;
+
+// Binding a reference odr-uses the arrays, which must then be defined.
+template <typename T>
+T const& at(T const* array, std::size_t n) { return array[n]; }
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(at(Table::slots, 0) == 0);
+    BOOST_HANA_RUNTIME_CHECK(at(Table::slots, 1) == hana::detail::no_slot);
+    BOOST_HANA_RUNTIME_CHECK(at(Table::slots, 2) == 1);
+
+    BOOST_HANA_RUNTIME_CHECK(at(Layout::values, 0) == 5);
+    BOOST_HANA_RUNTIME_CHECK(at(Layout::indices, 2) == 2);
+    BOOST_HANA_RUNTIME_CHECK(at(&Layout::slots[0], 0) == 1);
+    BOOST_HANA_RUNTIME_CHECK(at(&Layout::slots[0], 2) == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(at(ToHashTable::slots, 2) == 1);
+    BOOST_HANA_RUNTIME_CHECK(at(&ToHashTable::occupied[0], 1) == 2);
+}
@@ -0,0 +1,78 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <char ...c>
+using s = hana::string<c...>;
+
+// Keys "k00" to "k99"
+template <std::size_t i>
+using key = s<'k', static_cast<char>('0' + i / 10), static_cast<char>('0' + i % 10)>;
+
+template <std::size_t ...i>
+hana::detail::perfect_hash<key<i>...> make_hash(std::index_sequence<i...>);
+
+int main() {
+    // the hash computed at runtime is the one computed at compile-time
+    {
+        char const text[] = "abcdefghijklmnopqrstuvwxyz\x80\xff";
+        for (std::size_t size = 0; size != sizeof(text); ++size) {
+            BOOST_HANA_RUNTIME_CHECK(
+                hana::detail::perfect_hash_detail::runtime_hash(text, size) ==
+                hana::detail::perfect_hash_detail::hash(text, size)
+            );
+        }
+    }
+
+    {
+        using Hash = hana::detail::perfect_hash<>;
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("", 0) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("a", 1) == 0);
+    }
+
+    {
+        using Hash = hana::detail::perfect_hash<s<'a'>>;
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("a", 1) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("b", 1) == 1);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("", 0) == 1);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("ab", 2) == 1);
+    }
+
+    {
+        using Hash = hana::detail::perfect_hash<
+            s<'n', 'a', 'm', 'e'>, s<'a', 'g', 'e'>, s<>, s<'a', 'g', 'e', 's'>
+        >;
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("name", 4) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("age", 3) == 1);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("", 0) == 2);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("ages", 4) == 3);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("ag", 2) == 4);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("Name", 4) == 4);
+
+        // the string needs not be null-terminated
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("agent", 3) == 1);
+
+        BOOST_HANA_RUNTIME_CHECK(Hash::matches(0, "name", 4));
+        BOOST_HANA_RUNTIME_CHECK(!Hash::matches(0, "age", 3));
+    }
+
+    {
+        using Hash = decltype(make_hash(std::make_index_sequence<100>{}));
+        for (std::size_t i = 0; i != 100; ++i) {
+            std::string k = "k" + std::to_string(i / 10) + std::to_string(i % 10);
+            BOOST_HANA_RUNTIME_CHECK(Hash::find(k.data(), k.size()) == i);
+        }
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("k100", 4) == 100);
+        BOOST_HANA_RUNTIME_CHECK(Hash::find("k0", 2) == 100);
+    }
+}
@@ -31,6 +31,24 @@ static_assert(BOOST_HANA_PP_NARG(
     x, x, x, x, x, x, x, x, x, x,
     x, x, x, x, x, x, x, x, x, x,
     x, x, x, x, x, x, x, x, x, x) == 40, "");
+static_assert(BOOST_HANA_PP_NARG(
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+    x) == 257, "");
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,6 +75,18 @@ static_assert(BOOST_HANA_PP_BACK(1,   2,  3,  4,  5,  6,  7,  8,  9, 10,
                                  31, 32, 33, 34, 35, 36, 37, 38, 39, 40) == 40, "");
 
 
+//////////////////////////////////////////////////////////////////////////////
+// BOOST_HANA_PP_FOR_EACH
+//////////////////////////////////////////////////////////////////////////////
+#define ADD(data, i, x) (data * (i) + x)
+#define PLUS() +
+
+static_assert(0 BOOST_HANA_PP_FOR_EACH(ADD, PLUS, 10) == 0, "");
+static_assert(BOOST_HANA_PP_FOR_EACH(ADD, PLUS, 10, 1) == 1, "");
+static_assert(BOOST_HANA_PP_FOR_EACH(ADD, PLUS, 10, 1, 2) == 1 + 12, "");
+static_assert(BOOST_HANA_PP_FOR_EACH(ADD, PLUS, 10, 1, 2, 3) == 1 + 12 + 23, "");
+
+
 int main() {
     using Vector = std::vector<int>;
 
@@ -105,4 +135,15 @@ int main() {
             31, 32, 33, 34, 35, 36, 37, 38, 39
         });
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // BOOST_HANA_PP_FOR_EACH
+    //////////////////////////////////////////////////////////////////////////
+    {
+        Vector args = {BOOST_HANA_PP_FOR_EACH(ADD, BOOST_HANA_PP_COMMA, 0)};
+        BOOST_HANA_RUNTIME_CHECK(args.empty());
+    }{
+        Vector args = {BOOST_HANA_PP_FOR_EACH(ADD, BOOST_HANA_PP_COMMA, 100, 1, 2, 3)};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{1, 102, 203});
+    }
 }
@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/chunked_for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
+#include <vector>
+namespace hana = boost::hana;
+
+
+template <int K, typename Xs>
+std::vector<long> visit(Xs const& xs) {
+    std::vector<long> visited;
+    hana::experimental::chunked_for_each<K>(xs, [&](auto i) {
+        visited.push_back(i);
+    });
+    return visited;
+}
+
+int main() {
+    // ranges, whatever their size compared to the size of the chunks
+    {
+        std::vector<long> expected;
+        for (long i = -3; i != 100; ++i)
+            expected.push_back(i);
+        BOOST_HANA_RUNTIME_CHECK(visit<1>(hana::range_c<long, -3, 100>) == expected);
+        BOOST_HANA_RUNTIME_CHECK(visit<8>(hana::range_c<long, -3, 100>) == expected);
+        BOOST_HANA_RUNTIME_CHECK(visit<103>(hana::range_c<long, -3, 100>) == expected);
+        BOOST_HANA_RUNTIME_CHECK(visit<200>(hana::range_c<long, -3, 100>) == expected);
+
+        BOOST_HANA_RUNTIME_CHECK(visit<8>(hana::range_c<int, 0, 0>).empty());
+        BOOST_HANA_RUNTIME_CHECK((visit<8>(hana::range_c<int, 5, 6>) == std::vector<long>{5}));
+    }
+
+    // the function is called with runtime values
+    {
+        hana::experimental::chunked_for_each<>(hana::range_c<short, 0, 20>, [](auto i) {
+            static_assert(std::is_same<decltype(i), short>{}, "");
+        });
+    }
+
+    // sequences of Constants
+    {
+        BOOST_HANA_RUNTIME_CHECK((visit<3>(hana::tuple_c<int, 3, 1, 4, 1, 5, 9, 2, 6>) ==
+                                  std::vector<long>{3, 1, 4, 1, 5, 9, 2, 6}));
+        BOOST_HANA_RUNTIME_CHECK(visit<3>(hana::make_tuple()).empty());
+
+        // the values are converted to their common type
+        hana::experimental::chunked_for_each<2>(
+            hana::make_tuple(hana::int_c<1>, hana::long_c<2>, hana::char_c<'3'>),
+            [](auto i) {
+                static_assert(std::is_same<decltype(i), long>{}, "");
+            }
+        );
+        BOOST_HANA_RUNTIME_CHECK((visit<2>(hana::make_tuple(hana::int_c<1>, hana::long_c<2>, hana::char_c<'3'>)) ==
+                                  std::vector<long>{1, 2, '3'}));
+    }
+}
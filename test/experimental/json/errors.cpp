@@ -0,0 +1,110 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+// Returns the position of the error, or -1 if there is none.
+template <typename T>
+long error_position(std::string const& json) {
+    T t{};
+    if (auto error = hana::experimental::from_json(json, t))
+        return static_cast<long>(error.position());
+    return -1;
+}
+
+struct Tree {
+    BOOST_HANA_DEFINE_STRUCT(Tree,
+        (std::vector<Tree>, children)
+    );
+};
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("1") == -1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("1.5") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("1 2") == 2);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("2147483648") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<unsigned>("-1") == 1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::uint8_t>("256") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("x") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<bool>("tru") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::string>(R"("abc)") == 4);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::string>(R"("\x")") == 3);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::string>("\"a\nb\"") == 2);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"x": 1 "y": 2})") == 8);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"x": "1"})") == 6);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": [1, 2})") == 11);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::vector<int>>("[1, 2,]") == 6);
+    BOOST_HANA_RUNTIME_CHECK(error_position<std::vector<int>>("[1, 2") == 5);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": [)") == 7);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": "\u12)") == 11);
+
+    // numbers must follow the JSON grammar
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("-0") == -1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("+1") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("007") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("-") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<int>("--1") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("-0.5e+3") == -1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("+1") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>(".5") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("007") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("1.") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("1e") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("1e+") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("0x10") == 1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("inf") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": +1})") == 6);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": .5})") == 6);
+    BOOST_HANA_RUNTIME_CHECK(error_position<Point>(R"({"z": 007})") == 6);
+
+    // numbers must fit in the floating point type
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("1e999") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<double>("-1e999") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<float>("1e300") == 0);
+    BOOST_HANA_RUNTIME_CHECK(error_position<float>("3e38") == -1);
+    BOOST_HANA_RUNTIME_CHECK(error_position<float>("1e-300") == -1);
+
+    // the first error is reported
+    {
+        Point p{};
+        auto error = hana::experimental::from_json(R"({"x": true})", p);
+        BOOST_HANA_RUNTIME_CHECK(error);
+        BOOST_HANA_RUNTIME_CHECK(std::string{error.what()} ==
+            "hana::experimental::from_json: expected a number");
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::from_json(R"({"x": 1})", p));
+        BOOST_HANA_RUNTIME_CHECK(std::string{hana::experimental::from_json("1", p.x).what()} == "");
+    }
+
+    // deeply nested values are rejected
+    {
+        std::size_t const depth = hana::experimental::json_max_depth;
+        std::string ok = "{\"z\": " + std::string(depth - 1, '[') + std::string(depth - 1, ']') + "}";
+        BOOST_HANA_RUNTIME_CHECK(error_position<Point>(ok) == -1);
+
+        std::string deep = "{\"z\": " + std::string(100000, '[');
+        BOOST_HANA_RUNTIME_CHECK(error_position<Point>(deep) == static_cast<long>(6 + depth));
+
+        std::string tree;
+        for (std::size_t i = 0; i != 100000; ++i)
+            tree += "{\"children\": [";
+        BOOST_HANA_RUNTIME_CHECK(error_position<Tree>(tree) > 0);
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (bool, married),
+        (double, height),
+        (std::vector<Point>, places)
+    );
+};
+
+template <typename T>
+T read(std::string const& json, T result = T{}) {
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::from_json(json, result));
+    return result;
+}
+
+int main() {
+    // arithmetic types
+    {
+        BOOST_HANA_RUNTIME_CHECK(read<bool>("true") == true);
+        BOOST_HANA_RUNTIME_CHECK(read<bool>(" false ") == false);
+        BOOST_HANA_RUNTIME_CHECK(read<int>("-42") == -42);
+        BOOST_HANA_RUNTIME_CHECK(read<unsigned>("42") == 42u);
+        BOOST_HANA_RUNTIME_CHECK(
+            read<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min()
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            read<std::uint64_t>("18446744073709551615") == std::numeric_limits<std::uint64_t>::max()
+        );
+        BOOST_HANA_RUNTIME_CHECK(read<std::int8_t>("-128") == -128);
+        BOOST_HANA_RUNTIME_CHECK(read<double>("2.5e3") == 2500.0);
+        BOOST_HANA_RUNTIME_CHECK(read<float>("0.100000001") == 0.1f);
+        BOOST_HANA_RUNTIME_CHECK(std::isnan(read<double>("null")));
+
+        // numbers of any length are accepted
+        BOOST_HANA_RUNTIME_CHECK(read<double>("0." + std::string(100, '0') + "1e101") == 1.0);
+        BOOST_HANA_RUNTIME_CHECK(read<double>("1" + std::string(300, '0')) == 1e300);
+        BOOST_HANA_RUNTIME_CHECK(read<long double>("2.5" + std::string(70, '0')) == 2.5L);
+    }
+
+    // strings are unescaped
+    {
+        BOOST_HANA_RUNTIME_CHECK(read<std::string>(R"("abc")") == "abc");
+        BOOST_HANA_RUNTIME_CHECK(read<std::string>(R"("a\"b\\c\/\n\u0001")") == "a\"b\\c/\n\x01");
+        BOOST_HANA_RUNTIME_CHECK(read<std::string>(R"("é€")") == "\xC3\xA9\xE2\x82\xAC");
+        BOOST_HANA_RUNTIME_CHECK(read<std::string>(R"("😀")") == "\xF0\x9F\x98\x80");
+    }
+
+    // Structs are read from objects, whatever the order of the keys
+    {
+        Person john = read<Person>(R"({
+            "name": "John",
+            "age": 30,
+            "married": true,
+            "height": 1.8,
+            "places": [{"x": 1, "y": 2}, {"y": 4, "x": 3}]
+        })");
+        BOOST_HANA_RUNTIME_CHECK(john.name == "John");
+        BOOST_HANA_RUNTIME_CHECK(john.age == 30);
+        BOOST_HANA_RUNTIME_CHECK(john.married);
+        BOOST_HANA_RUNTIME_CHECK(john.height == 1.8);
+        BOOST_HANA_RUNTIME_CHECK(john.places.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(john.places[1].x == 3 && john.places[1].y == 4);
+
+        Person jane = read<Person>(R"({"age":25,"places":[],"name":"Jane","married":false})");
+        BOOST_HANA_RUNTIME_CHECK(jane.name == "Jane");
+        BOOST_HANA_RUNTIME_CHECK(jane.age == 25);
+        BOOST_HANA_RUNTIME_CHECK(jane.places.empty());
+    }
+
+    // unknown keys are skipped, and missing members are left unchanged
+    {
+        Point p = read<Point>(R"({"z": {"a": [1, "}", null, true]}, "x": 5, "w": -1.5e-3})", Point{1, 2});
+        BOOST_HANA_RUNTIME_CHECK(p.x == 5 && p.y == 2);
+
+        Point q = read<Point>("{}", Point{1, 2});
+        BOOST_HANA_RUNTIME_CHECK(q.x == 1 && q.y == 2);
+    }
+
+    // keys with escape sequences
+    {
+        Point p = read<Point>(R"({"\u0078": 7, "y": 8})");
+        BOOST_HANA_RUNTIME_CHECK(p.x == 7 && p.y == 8);
+    }
+
+    // hana::map
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("a"), 0),
+            hana::make_pair(BOOST_HANA_STRING("b"), std::string{})
+        );
+        hana::experimental::from_json(R"({"b": "x", "a": 1})", map);
+        BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_STRING("a")] == 1);
+        BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_STRING("b")] == "x");
+    }
+
+    // Sequences and std containers
+    {
+        auto t = hana::make_tuple(0, std::string{}, Point{0, 0});
+        hana::experimental::from_json(R"([1, "a", {"x": 2, "y": 3}])", t);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(t) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(t) == "a");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(t).y == 3);
+
+        BOOST_HANA_RUNTIME_CHECK((read<std::array<int, 3>>("[1,2,3]") == std::array<int, 3>{{1, 2, 3}}));
+        BOOST_HANA_RUNTIME_CHECK((read<std::vector<int>>("[1, 2, 3]", {4, 5, 6, 7}) == std::vector<int>{1, 2, 3}));
+        BOOST_HANA_RUNTIME_CHECK((read<std::vector<int>>(" [ ] ", {4}).empty()));
+        BOOST_HANA_RUNTIME_CHECK((read<std::vector<bool>>("[true,false]") == std::vector<bool>{true, false}));
+    }
+
+    // round trip
+    {
+        Person john{"Jo\"hn", -30, true, 0.1, {{1, 2}}};
+        Person copy = read<Person>(hana::experimental::to_json(john));
+        BOOST_HANA_RUNTIME_CHECK(copy.name == john.name);
+        BOOST_HANA_RUNTIME_CHECK(copy.age == john.age);
+        BOOST_HANA_RUNTIME_CHECK(copy.height == john.height);
+        BOOST_HANA_RUNTIME_CHECK(copy.places.size() == 1 && copy.places[0].y == 2);
+    }
+}
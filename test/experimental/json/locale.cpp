@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include <clocale>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// Numbers are written and read with a '.' whatever the decimal point of the
+// C locale. Locales using a decimal comma are tried, and the checks are done
+// in the "C" locale when none of them is available.
+int main() {
+    char const* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8",
+                             "fr_FR.utf8", "fr_FR", "German", "French"};
+    for (char const* name : locales) {
+        if (std::setlocale(LC_NUMERIC, name))
+            break;
+    }
+
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(1.5) == "1.5");
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(-2.5f) == "-2.5");
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(0.25L) == "0.25");
+
+    double d = 0;
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::from_json("1.5", d));
+    BOOST_HANA_RUNTIME_CHECK(d == 1.5);
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::from_json("1,5", d));
+
+    long double ld = 0;
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::from_json("0.25e1", ld));
+    BOOST_HANA_RUNTIME_CHECK(ld == 2.5L);
+
+    std::vector<double> v;
+    BOOST_HANA_RUNTIME_CHECK(!hana::experimental::from_json("[0.5,1.25]", v));
+    BOOST_HANA_RUNTIME_CHECK((v == std::vector<double>{0.5, 1.25}));
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(v) == "[0.5,1.25]");
+
+    std::setlocale(LC_NUMERIC, "C");
+}
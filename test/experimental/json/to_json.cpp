@@ -0,0 +1,124 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (bool, married),
+        (std::vector<Point>, places)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+class Car {
+    std::string brand_;
+
+public:
+    explicit Car(std::string brand) : brand_(brand) { }
+    std::string brand() const { return brand_; }
+};
+
+BOOST_HANA_ADAPT_ADT(Car,
+    (brand, [](Car const& c) { return c.brand(); })
+);
+
+int main() {
+    // arithmetic types
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(true) == "true");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(false) == "false");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(-42) == "-42");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(1234567u) == "1234567");
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::to_json(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808"
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::to_json(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615"
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(2.5) == "2.5");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(0.1f) == "0.100000001");
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::to_json(std::numeric_limits<double>::infinity()) == "null"
+        );
+    }
+
+    // strings are escaped
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(std::string{"abc"}) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::to_json(std::string{"a\"b\\c\nd\x01"}) == R"("a\"b\\c\nd\u0001")"
+        );
+    }
+
+    // Structs are written as objects
+    {
+        Person john{"John", 30, true, {{1, 2}, {3, 4}}};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(john) ==
+            R"({"name":"John","age":30,"married":true,"places":[{"x":1,"y":2},{"x":3,"y":4}]})"
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(Empty{}) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(Car{"BMW"}) == R"({"brand":"BMW"})");
+    }
+
+    // the output is appended to the buffer
+    {
+        std::string buffer = "[";
+        hana::experimental::to_json(buffer, Point{1, 2});
+        buffer += ",";
+        hana::experimental::to_json(buffer, Point{3, 4});
+        buffer += "]";
+        BOOST_HANA_RUNTIME_CHECK(buffer == R"([{"x":1,"y":2},{"x":3,"y":4}])");
+    }
+
+    // the keys of maps are escaped at compile-time
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("a"), 1),
+            hana::make_pair(BOOST_HANA_STRING("quote\"d"), std::string{"x"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(map) == R"({"a":1,"quote\"d":"x"})");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(hana::make_map()) == "{}");
+    }
+
+    // Sequences and std containers are written as arrays
+    {
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::to_json(hana::make_tuple(1, std::string{"a"}, Point{1, 2}))
+                == R"([1,"a",{"x":1,"y":2}])"
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(hana::make_tuple()) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(std::array<int, 3>{{1, 2, 3}}) == "[1,2,3]");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(std::vector<int>{}) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(std::vector<bool>{true, false}) == "[true,false]");
+    }
+}
@@ -0,0 +1,15 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_EXPERIMENTAL_PACKED_TUPLE_AUTO_SPECS_HPP
+#define BOOST_HANA_TEST_EXPERIMENTAL_PACKED_TUPLE_AUTO_SPECS_HPP
+
+#include <boost/hana/experimental/packed_tuple.hpp>
+
+
+#define MAKE_TUPLE(...) ::boost::hana::experimental::make_packed_tuple(__VA_ARGS__)
+#define TUPLE_TYPE(...) ::boost::hana::experimental::packed_tuple<__VA_ARGS__>
+#define TUPLE_TAG ::boost::hana::experimental::packed_tuple_tag
+
+#endif // !BOOST_HANA_TEST_EXPERIMENTAL_PACKED_TUPLE_AUTO_SPECS_HPP
@@ -0,0 +1,99 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/packed_tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not_equal.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct by_alignment { double d; int i; char c1; char c2; };
+
+struct empty { };
+
+int main() {
+    // the elements are stored by decreasing alignment
+    {
+        using Packed = hana::experimental::packed_tuple<char, double, char, int>;
+        static_assert(sizeof(Packed) == sizeof(by_alignment), "");
+        static_assert(sizeof(Packed) <= sizeof(hana::tuple<char, double, char, int>), "");
+        static_assert(std::is_same<
+            Packed::layout_::storage_type,
+            hana::basic_tuple<double, int, char, char>
+        >{}, "");
+
+        static_assert(std::is_same<
+            hana::experimental::packed_tuple<std::int16_t, char, std::int16_t, empty, std::int64_t>::layout_::storage_type,
+            hana::basic_tuple<std::int64_t, std::int16_t, std::int16_t, char, empty>
+        >{}, "");
+    }
+
+    // but they are accessed in the order in which they are given
+    {
+        hana::experimental::packed_tuple<char, double, char, int> xs{'a', 1.5, 'b', 3};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs) == 'a');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs) == 'b');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<3>(xs) == 3);
+
+        hana::at_c<2>(xs) = 'c';
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs) == 'c');
+
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(xs, [](char a, double b, char c, int d) {
+            return a == 'a' && b == 1.5 && c == 'c' && d == 3;
+        }));
+
+        BOOST_HANA_RUNTIME_CHECK(xs == hana::experimental::make_packed_tuple('a', 1.5, 'c', 3));
+        BOOST_HANA_RUNTIME_CHECK(xs != hana::experimental::make_packed_tuple('a', 1.5, 'b', 3));
+        BOOST_HANA_RUNTIME_CHECK(xs[hana::size_c<1>] == 1.5);
+    }
+
+    // constexpr construction and access
+    {
+        constexpr hana::experimental::packed_tuple<char, long long, short> xs{'x', 2, 3};
+        static_assert(hana::at_c<0>(xs) == 'x', "");
+        static_assert(hana::at_c<1>(xs) == 2, "");
+        static_assert(hana::at_c<2>(xs) == 3, "");
+    }
+
+    // the value category is preserved
+    {
+        hana::experimental::packed_tuple<char, std::unique_ptr<int>, std::string> xs{
+            'a', std::make_unique<int>(3), std::string{"abc"}
+        };
+        std::unique_ptr<int> p = hana::at_c<1>(std::move(xs));
+        BOOST_HANA_RUNTIME_CHECK(*p == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == nullptr);
+
+        auto const& cxs = xs;
+        static_assert(std::is_same<decltype(hana::at_c<2>(cxs)), std::string const&>{}, "");
+
+        hana::experimental::packed_tuple<char, std::unique_ptr<int>, std::string> ys = std::move(xs);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(ys) == "abc");
+    }
+
+    // default construction and copies
+    {
+        hana::experimental::packed_tuple<char, int> xs;
+        xs = hana::experimental::packed_tuple<char, int>{'a', 1};
+        hana::experimental::packed_tuple<char, int> ys = xs;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 'a');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 1);
+
+        hana::experimental::packed_tuple<std::string> single{"abc"};
+        hana::experimental::packed_tuple<std::string> copy = single;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(copy) == "abc");
+    }
+}
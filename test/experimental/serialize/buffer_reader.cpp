@@ -0,0 +1,124 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// Reader which does not know how many bytes it has left.
+struct stream_reader {
+    std::string const& buffer;
+    std::size_t position;
+
+    bool read(char* data, std::size_t size) {
+        if (size > buffer.size() - position)
+            return false;
+        std::memcpy(data, buffer.data() + position, size);
+        position += size;
+        return true;
+    }
+};
+
+int main() {
+    // reading past the end of the buffer fails
+    {
+        std::string bytes = hana::experimental::serialize(hana::make_tuple(1, 2));
+        hana::experimental::buffer_reader reader{bytes.data(), bytes.size() - 1};
+        auto t = hana::make_tuple(0, 0);
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader, t));
+    }
+
+    // sizes requiring more bytes than what is left are rejected
+    {
+        std::string bytes = hana::experimental::serialize(std::uint64_t{1} << 40);
+        bytes += 'x';
+
+        hana::experimental::buffer_reader reader{bytes};
+        std::vector<double> v;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader, v));
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() == 0);
+
+        hana::experimental::buffer_reader reader2{bytes};
+        std::string s;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader2, s));
+        BOOST_HANA_RUNTIME_CHECK(s.size() < 64);
+
+        hana::experimental::buffer_reader reader3{bytes};
+        std::vector<bool> b;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader3, b));
+        BOOST_HANA_RUNTIME_CHECK(b.capacity() == 0);
+    }
+
+    // containers are only grown as their elements are read
+    {
+        std::string bytes = hana::experimental::serialize(std::uint64_t{1} << 40);
+        bytes += hana::experimental::serialize(std::string{"abc"});
+
+        hana::experimental::buffer_reader reader{bytes};
+        std::vector<std::string> v;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader, v));
+        BOOST_HANA_RUNTIME_CHECK(v.size() <= 64);
+
+        stream_reader stream{bytes, 0};
+        std::vector<int> w;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(stream, w));
+        BOOST_HANA_RUNTIME_CHECK(w.size() <= 64);
+    }
+
+    // readers without remaining() can be used
+    {
+        std::vector<int> v(1000);
+        for (std::size_t i = 0; i != v.size(); ++i)
+            v[i] = static_cast<int>(i);
+        std::string bytes = hana::experimental::serialize(v);
+
+        stream_reader stream{bytes, 0};
+        std::vector<int> result;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(stream, result));
+        BOOST_HANA_RUNTIME_CHECK(result == v);
+        BOOST_HANA_RUNTIME_CHECK(stream.position == bytes.size());
+    }
+
+    // bools other than 0 and 1 are rejected
+    {
+        std::string bytes = hana::experimental::serialize(hana::make_tuple(1, true));
+        bytes.back() = 2;
+        hana::experimental::buffer_reader reader{bytes};
+        auto t = hana::make_tuple(0, false);
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader, t));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(t) == false);
+
+        std::string bits = hana::experimental::serialize(std::vector<bool>{true, false});
+        bits.back() = '\xff';
+        hana::experimental::buffer_reader reader2{bits};
+        std::vector<bool> b;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader2, b));
+    }
+
+    // several objects can be read from the same buffer
+    {
+        std::string bytes;
+        hana::experimental::string_writer writer{bytes};
+        hana::experimental::serialize(writer, std::string{"abc"});
+        hana::experimental::serialize(writer, std::vector<int>{1, 2});
+
+        hana::experimental::buffer_reader reader{bytes};
+        std::string s;
+        std::vector<int> v;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, s));
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, v));
+        BOOST_HANA_RUNTIME_CHECK(s == "abc");
+        BOOST_HANA_RUNTIME_CHECK((v == std::vector<int>{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(reader.remaining() == 0);
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/ext/std/pair.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+template <typename T>
+T round_trip(T const& t, T result) {
+    std::string bytes = hana::experimental::serialize(t);
+    hana::experimental::buffer_reader reader{bytes};
+    hana::experimental::deserialize(reader, result);
+    BOOST_HANA_RUNTIME_CHECK(reader.remaining() == 0);
+    return result;
+}
+
+int main() {
+    // arithmetic types
+    {
+        BOOST_HANA_RUNTIME_CHECK(round_trip(42, 0) == 42);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(2.5, 0.0) == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize('x') == "x");
+    }
+
+    // hana::tuple
+    {
+        auto t = round_trip(hana::make_tuple(1, 'x', std::string{"abc"}),
+                            hana::make_tuple(0, ' ', std::string{}));
+        BOOST_HANA_RUNTIME_CHECK(t == hana::make_tuple(1, 'x', std::string{"abc"}));
+
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize(hana::make_tuple()).empty());
+
+        // Constants are not written
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::serialize(hana::make_tuple(hana::int_c<1>, 'x')) == "x"
+        );
+    }
+
+    // hana::pair
+    {
+        auto p = round_trip(hana::make_pair(1, std::string{"abc"}),
+                            hana::make_pair(0, std::string{}));
+        BOOST_HANA_RUNTIME_CHECK(p == hana::make_pair(1, std::string{"abc"}));
+    }
+
+    // hana::map
+    {
+        auto m = hana::make_map(
+            hana::make_pair(hana::type_c<int>, 1),
+            hana::make_pair(hana::int_c<2>, std::string{"abc"})
+        );
+        auto n = hana::make_map(
+            hana::make_pair(hana::type_c<int>, 0),
+            hana::make_pair(hana::int_c<2>, std::string{})
+        );
+        n = round_trip(m, n);
+        BOOST_HANA_RUNTIME_CHECK(n[hana::type_c<int>] == 1);
+        BOOST_HANA_RUNTIME_CHECK(n[hana::int_c<2>] == "abc");
+    }
+
+    // std::pair and std::tuple
+    {
+        BOOST_HANA_RUNTIME_CHECK(
+            round_trip(std::make_pair(1, 'x'), std::make_pair(0, ' ')) == std::make_pair(1, 'x')
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            round_trip(std::make_tuple(1, 'x', 2.5), std::make_tuple(0, ' ', 0.0))
+                == std::make_tuple(1, 'x', 2.5)
+        );
+    }
+
+    // std::array
+    {
+        std::array<int, 3> a{{1, 2, 3}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(a, {}) == a);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize(a).size() == 3 * sizeof(int));
+
+        std::array<std::string, 2> s{{"abc", "de"}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(s, {}) == s);
+    }
+
+    // std::vector
+    {
+        std::vector<int> v{1, 2, 3};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(v, {}) == v);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(v, {4, 5, 6, 7, 8}) == v);
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::serialize(v).size() == sizeof(std::uint64_t) + 3 * sizeof(int)
+        );
+
+        std::vector<int> empty;
+        BOOST_HANA_RUNTIME_CHECK(round_trip(empty, {1, 2}) == empty);
+
+        std::vector<std::vector<int>> nested{{1}, {}, {2, 3}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(nested, {}) == nested);
+
+        std::vector<bool> bits{true, false, true};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(bits, {}) == bits);
+
+        std::vector<Point> points{{1, 2}, {3, 4}};
+        std::vector<Point> result = round_trip(points, {});
+        BOOST_HANA_RUNTIME_CHECK(result.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(result[0].x == 1 && result[0].y == 2);
+        BOOST_HANA_RUNTIME_CHECK(result[1].x == 3 && result[1].y == 4);
+    }
+
+    // std::string
+    {
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::string{"abc"}, {}) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::string{}, std::string{"abc"}) == "");
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::wstring{L"abc"}, {}) == L"abc");
+    }
+}
@@ -0,0 +1,276 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// Records the size of each block of bytes it is given.
+struct block_writer {
+    std::string buffer;
+    std::vector<std::size_t> blocks;
+
+    void write(char const* data, std::size_t size) {
+        buffer.append(data, size);
+        blocks.push_back(size);
+    }
+};
+
+enum class Color : unsigned char { red, green, blue };
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y),
+        (int, z)
+    );
+};
+
+struct Padded {
+    BOOST_HANA_DEFINE_STRUCT(Padded,
+        (char, c),
+        (double, d),
+        (Color, color)
+    );
+};
+
+struct Segment {
+    BOOST_HANA_DEFINE_STRUCT(Segment,
+        (Point, from),
+        (Point, to)
+    );
+};
+
+struct Named {
+    BOOST_HANA_DEFINE_STRUCT(Named,
+        (int, id),
+        (std::string, name),
+        (int, age),
+        (int, height)
+    );
+};
+
+// `b`, `c` and `d` are never preceded by padding after `a`.
+struct Packed {
+    BOOST_HANA_DEFINE_STRUCT(Packed,
+        (int, a),
+        (char, b),
+        (char, c),
+        (short, d)
+    );
+};
+
+// Without padding, even though `x` may need to be preceded by padding
+// depending on the offset of `id`.
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (int, flags),
+        (double, x)
+    );
+};
+
+// `d` may be preceded by padding, depending on the offset of `a`.
+struct Unaligned {
+    BOOST_HANA_DEFINE_STRUCT(Unaligned,
+        (char, a),
+        (char, b),
+        (int, d)
+    );
+};
+
+struct Flags {
+    BOOST_HANA_DEFINE_STRUCT(Flags,
+        (int, x),
+        (bool, visible),
+        (int, y)
+    );
+};
+
+struct Adapted {
+    int x, y, z;
+};
+
+BOOST_HANA_ADAPT_STRUCT(Adapted, z, y, x);
+
+// trivially copyable, but not a Struct
+struct Raw {
+    int a;
+    float b;
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+class Person {
+    std::string name_;
+    int age_;
+
+public:
+    Person(std::string name, int age) : name_(name), age_(age) { }
+    std::string name() const { return name_; }
+    int age() const { return age_; }
+};
+
+BOOST_HANA_ADAPT_ADT(Person,
+    (name, [](Person const& p) { return p.name(); }),
+    (age, [](Person const& p) { return p.age(); })
+);
+
+int main() {
+    // adjacent members are written at once
+    {
+        Point p{1, 2, 3};
+        block_writer writer;
+        hana::experimental::serialize(writer, p);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{3 * sizeof(int)});
+
+        Point q{0, 0, 0};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        hana::experimental::deserialize(reader, q);
+        BOOST_HANA_RUNTIME_CHECK(q.x == 1 && q.y == 2 && q.z == 3);
+        BOOST_HANA_RUNTIME_CHECK(reader.remaining() == 0);
+    }
+
+    // members separated by padding are written separately, without the padding
+    {
+        Padded p{'a', 2.5, Color::blue};
+        block_writer writer;
+        hana::experimental::serialize(writer, p);
+        BOOST_HANA_RUNTIME_CHECK(writer.buffer.size() == sizeof(char) + sizeof(double) + sizeof(Color));
+
+        Padded q{'z', 0.0, Color::red};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        hana::experimental::deserialize(reader, q);
+        BOOST_HANA_RUNTIME_CHECK(q.c == 'a' && q.d == 2.5 && q.color == Color::blue);
+    }
+
+    // adjacent members of nested Structs are written at once too
+    {
+        Segment s{{1, 2, 3}, {4, 5, 6}};
+        block_writer writer;
+        hana::experimental::serialize(writer, s);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{6 * sizeof(int)});
+
+        Segment t{};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        hana::experimental::deserialize(reader, t);
+        BOOST_HANA_RUNTIME_CHECK(t.from.x == 1 && t.from.z == 3 && t.to.x == 4 && t.to.z == 6);
+    }
+
+    // runs are split where the layout could require padding
+    {
+        Packed p{1, 'b', 'c', 4};
+        block_writer writer;
+        hana::experimental::serialize(writer, p);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{sizeof(Packed)});
+
+        std::vector<Record> records{{1, 2, 3.0}, {4, 5, 6.0}};
+        block_writer writer1;
+        hana::experimental::serialize(writer1, records);
+        BOOST_HANA_RUNTIME_CHECK(sizeof(Record) != 2 * sizeof(int) + sizeof(double) ||
+            writer1.blocks == (std::vector<std::size_t>{sizeof(std::uint64_t), 2 * sizeof(Record)}));
+
+        Unaligned u{'a', 'b', 4};
+        block_writer writer2;
+        hana::experimental::serialize(writer2, u);
+        BOOST_HANA_RUNTIME_CHECK(writer2.blocks == std::vector<std::size_t>{2, sizeof(int)});
+
+        Unaligned v{};
+        hana::experimental::buffer_reader reader{writer2.buffer};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, v));
+        BOOST_HANA_RUNTIME_CHECK(v.a == 'a' && v.b == 'b' && v.d == 4);
+    }
+
+    // bools are written and validated one at a time
+    {
+        Flags f{1, true, 2};
+        block_writer writer;
+        hana::experimental::serialize(writer, f);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{sizeof(int), 1, sizeof(int)});
+
+        Flags g{};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, g));
+        BOOST_HANA_RUNTIME_CHECK(g.x == 1 && g.visible && g.y == 2);
+
+        std::string bytes = writer.buffer;
+        bytes[sizeof(int)] = 3;
+        Flags h{};
+        hana::experimental::buffer_reader reader2{bytes};
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::deserialize(reader2, h));
+        BOOST_HANA_RUNTIME_CHECK(!h.visible);
+    }
+
+    // the members of other Structs are written one at a time, in the
+    // order of their accessors
+    {
+        Adapted a{1, 2, 3};
+        block_writer writer;
+        hana::experimental::serialize(writer, a);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{
+            sizeof(int), sizeof(int), sizeof(int)
+        });
+
+        Adapted b{0, 0, 0};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, b));
+        BOOST_HANA_RUNTIME_CHECK(b.x == 1 && b.y == 2 && b.z == 3);
+    }
+
+    // other trivially copyable types are written as is
+    {
+        Raw r{1, 2.5f};
+        block_writer writer;
+        hana::experimental::serialize(writer, r);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{sizeof(Raw)});
+
+        Raw s{0, 0.0f};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(reader, s));
+        BOOST_HANA_RUNTIME_CHECK(s.a == 1 && s.b == 2.5f);
+    }
+
+    // members that are not written as is break the runs
+    {
+        Named n{1, "John", 30, 180};
+        block_writer writer;
+        hana::experimental::serialize(writer, n);
+        BOOST_HANA_RUNTIME_CHECK(writer.blocks == std::vector<std::size_t>{
+            sizeof(int), sizeof(std::uint64_t), 4, 2 * sizeof(int)
+        });
+
+        Named m{0, "", 0, 0};
+        hana::experimental::buffer_reader reader{writer.buffer};
+        hana::experimental::deserialize(reader, m);
+        BOOST_HANA_RUNTIME_CHECK(m.id == 1 && m.name == "John" && m.age == 30 && m.height == 180);
+    }
+
+    // empty Structs are not written at all
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize(Empty{}).empty());
+        Empty e;
+        hana::experimental::buffer_reader reader{nullptr, 0};
+        hana::experimental::deserialize(reader, e);
+    }
+
+    // Structs whose accessors return values can still be serialized
+    {
+        Person john{"John", 30};
+        Named expected{0, "John", 30, 0};
+        std::string bytes = hana::experimental::serialize(john);
+        std::string named = hana::experimental::serialize(expected);
+        BOOST_HANA_RUNTIME_CHECK(bytes == named.substr(sizeof(int), bytes.size()));
+    }
+}
@@ -0,0 +1,278 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Particle {
+    BOOST_HANA_DEFINE_STRUCT(Particle,
+        (double, x),
+        (double, y),
+        (std::string, name)
+    );
+};
+
+struct Flagged {
+    BOOST_HANA_DEFINE_STRUCT(Flagged,
+        (int, id),
+        (bool, flag)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct WithMoveOnly {
+    BOOST_HANA_DEFINE_STRUCT(WithMoveOnly,
+        (int, id),
+        (std::unique_ptr<int>, value)
+    );
+};
+
+#ifdef BOOST_HANA_CONFIG_HAS_EXCEPTIONS
+// Throws when copied after `countdown` reaches 0.
+struct ThrowOnCopy {
+    static int countdown;
+    ThrowOnCopy() = default;
+    ThrowOnCopy(ThrowOnCopy const&) {
+        if (countdown-- == 0)
+            throw std::runtime_error{"copy"};
+    }
+    ThrowOnCopy& operator=(ThrowOnCopy const&) = default;
+};
+int ThrowOnCopy::countdown = 0;
+
+struct MayThrow {
+    BOOST_HANA_DEFINE_STRUCT(MayThrow,
+        (std::string, name),
+        (ThrowOnCopy, thrower)
+    );
+};
+
+// Throws when default constructed after `countdown` reaches 0.
+struct ThrowOnConstruct {
+    static int countdown;
+    ThrowOnConstruct() {
+        if (countdown-- == 0)
+            throw std::runtime_error{"construct"};
+    }
+};
+int ThrowOnConstruct::countdown = 0;
+
+struct MayThrowOnResize {
+    BOOST_HANA_DEFINE_STRUCT(MayThrowOnResize,
+        (std::string, name),
+        (ThrowOnConstruct, thrower)
+    );
+};
+#endif
+
+int main() {
+    using Particles = hana::experimental::soa_vector<Particle>;
+    auto x = BOOST_HANA_STRING("x");
+    auto y = BOOST_HANA_STRING("y");
+    auto name = BOOST_HANA_STRING("name");
+
+    // push_back, emplace_back, size and element access
+    {
+        Particles ps;
+        BOOST_HANA_RUNTIME_CHECK(ps.empty());
+
+        Particle p{1.0, 2.0, "a"};
+        ps.push_back(p);
+        ps.push_back(Particle{3.0, 4.0, "b"});
+        ps.emplace_back(5.0, 6.0, "c");
+        BOOST_HANA_RUNTIME_CHECK(ps.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(!ps.empty());
+
+        Particle q = ps[1];
+        BOOST_HANA_RUNTIME_CHECK(q.x == 3.0 && q.y == 4.0 && q.name == "b");
+        BOOST_HANA_RUNTIME_CHECK(ps[2][name] == "c");
+        BOOST_HANA_RUNTIME_CHECK(ps.front()[x] == 1.0);
+        BOOST_HANA_RUNTIME_CHECK(ps.back()[y] == 6.0);
+
+        // references write through to the container
+        ps[0][x] = 10.0;
+        ps[1] = Particle{7.0, 8.0, "d"};
+        ps[2] = ps[0];
+        BOOST_HANA_RUNTIME_CHECK(ps[0][x] == 10.0);
+        BOOST_HANA_RUNTIME_CHECK(static_cast<Particle>(ps[1]).name == "d");
+        BOOST_HANA_RUNTIME_CHECK(ps[2][x] == 10.0 && ps[2][name] == "a");
+
+        Particles const& cps = ps;
+        static_assert(std::is_same<decltype(cps[0][x]), double const&>{}, "");
+        static_assert(std::is_same<decltype(ps[0][x]), double&>{}, "");
+
+        ps.pop_back();
+        BOOST_HANA_RUNTIME_CHECK(ps.size() == 2);
+        ps.resize(4);
+        BOOST_HANA_RUNTIME_CHECK(ps.size() == 4);
+        BOOST_HANA_RUNTIME_CHECK(ps[3][x] == 0.0 && ps[3][name] == "");
+        ps.clear();
+        BOOST_HANA_RUNTIME_CHECK(ps.empty());
+    }
+
+    // references are Structs with the same keys as the element type
+    {
+        Particles ps;
+        ps.push_back(Particle{1.0, 2.0, "a"});
+        auto ref = ps[0];
+        static_assert(hana::Struct<decltype(ref)>::value, "");
+        BOOST_HANA_CONSTANT_CHECK(hana::keys(ref) == hana::keys(Particle{}));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(ref, y) == 2.0);
+        BOOST_HANA_RUNTIME_CHECK(hana::members(ref) == hana::make_tuple(1.0, 2.0, "a"));
+
+        hana::at_key(ref, name) = "z";
+        BOOST_HANA_RUNTIME_CHECK(ps[0][name] == "z");
+    }
+
+    // span and iteration
+    {
+        Particles ps;
+        for (int i = 0; i < 10; ++i)
+            ps.push_back(Particle{double(i), double(2 * i), std::to_string(i)});
+
+        double sum = 0;
+        for (double v : ps.span(x))
+            sum += v;
+        BOOST_HANA_RUNTIME_CHECK(sum == 45.0);
+
+        auto ys = ps.span(y);
+        BOOST_HANA_RUNTIME_CHECK(ys.size() == 10);
+        BOOST_HANA_RUNTIME_CHECK(ys[3] == 6.0);
+        ys[3] = 0.0;
+        BOOST_HANA_RUNTIME_CHECK(ps[3][y] == 0.0);
+
+        Particles const& cps = ps;
+        static_assert(std::is_same<decltype(cps.span(y)[0]), double const&>{}, "");
+
+        std::string names;
+        for (auto p : ps)
+            names += p[name];
+        BOOST_HANA_RUNTIME_CHECK(names == "0123456789");
+
+        BOOST_HANA_RUNTIME_CHECK(ps.end() - ps.begin() == 10);
+        BOOST_HANA_RUNTIME_CHECK((*(ps.begin() + 4))[x] == 4.0);
+        Particles::const_iterator it = ps.begin();
+        BOOST_HANA_RUNTIME_CHECK(it == cps.begin());
+        BOOST_HANA_RUNTIME_CHECK(std::count_if(cps.begin(), cps.end(), [](auto p) {
+            return p[BOOST_HANA_STRING("x")] > 4.0;
+        }) == 5);
+    }
+
+    // bool members are stored contiguously
+    {
+        hana::experimental::soa_vector<Flagged> fs;
+        auto flag = BOOST_HANA_STRING("flag");
+        for (int i = 0; i < 10; ++i)
+            fs.push_back(Flagged{i, i % 3 == 0});
+        fs.emplace_back(10, 1);
+
+        auto flags = fs.span(flag);
+        static_assert(std::is_same<decltype(flags.data()), bool*>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(flags.size() == 11);
+        BOOST_HANA_RUNTIME_CHECK(std::count(flags.begin(), flags.end(), true) == 5);
+        static_assert(std::is_same<decltype(fs[0][flag]), bool&>{}, "");
+        fs[1][flag] = true;
+        BOOST_HANA_RUNTIME_CHECK(static_cast<Flagged>(fs[1]).flag);
+
+        auto copy = fs;
+        copy[0][flag] = false;
+        BOOST_HANA_RUNTIME_CHECK(fs[0][flag] && !copy[0][flag]);
+        copy = fs;
+        BOOST_HANA_RUNTIME_CHECK(copy[0][flag]);
+
+        auto moved = std::move(copy);
+        BOOST_HANA_RUNTIME_CHECK(moved.span(flag).size() == 11);
+        BOOST_HANA_RUNTIME_CHECK(moved[10][flag]);
+
+        fs.resize(20);
+        BOOST_HANA_RUNTIME_CHECK(fs.size() == 20 && !fs[19][flag]);
+        fs.pop_back();
+        fs.resize(5);
+        BOOST_HANA_RUNTIME_CHECK(fs.span(flag).size() == 5);
+        BOOST_HANA_RUNTIME_CHECK(fs[3][flag] && !fs[4][flag]);
+        fs.clear();
+        BOOST_HANA_RUNTIME_CHECK(fs.span(flag).empty());
+    }
+
+    // structs without members
+    {
+        hana::experimental::soa_vector<Empty> es;
+        es.push_back(Empty{});
+        es.emplace_back();
+        BOOST_HANA_RUNTIME_CHECK(es.size() == 2);
+    }
+
+    // move-only members
+    {
+        hana::experimental::soa_vector<WithMoveOnly> ms;
+        ms.push_back(WithMoveOnly{1, std::make_unique<int>(2)});
+        ms.emplace_back(3, std::make_unique<int>(4));
+        BOOST_HANA_RUNTIME_CHECK(*ms[1][BOOST_HANA_STRING("value")] == 4);
+    }
+
+#ifdef BOOST_HANA_CONFIG_HAS_EXCEPTIONS
+    // adding an element is all-or-nothing
+    {
+        hana::experimental::soa_vector<MayThrow> ts;
+        MayThrow t{"a", {}};
+        ThrowOnCopy::countdown = 1;
+        ts.push_back(t);
+        bool thrown = false;
+        try {
+            ts.push_back(t);
+        } catch (std::runtime_error const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(ts.size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(ts.span(BOOST_HANA_STRING("name")).size() == 1);
+        ts.push_back(MayThrow{"b", {}});
+        BOOST_HANA_RUNTIME_CHECK(ts[1][BOOST_HANA_STRING("name")] == "b");
+    }
+
+    // resizing is all-or-nothing
+    {
+        hana::experimental::soa_vector<MayThrowOnResize> ts;
+        ThrowOnConstruct::countdown = 2;
+        ts.resize(2);
+        bool thrown = false;
+        try {
+            ts.resize(10);
+        } catch (std::runtime_error const&) {
+            thrown = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(ts.size() == 2);
+        ThrowOnConstruct::countdown = -1;
+        ts.push_back(MayThrowOnResize{"b", {}});
+        BOOST_HANA_RUNTIME_CHECK(ts.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(ts[2][BOOST_HANA_STRING("name")] == "b");
+        ts.resize(10);
+        ts.push_back(MayThrowOnResize{"c", {}});
+        BOOST_HANA_RUNTIME_CHECK(ts.size() == 11);
+        BOOST_HANA_RUNTIME_CHECK(ts[10][BOOST_HANA_STRING("name")] == "c");
+    }
+#endif
+}
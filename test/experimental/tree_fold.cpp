@@ -0,0 +1,85 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/tree_fold.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>)
+{ return hana::make_tuple(static_cast<T>(i)...); }
+
+struct concat {
+    std::string operator()(std::string const& x, std::string const& y) const
+    { return x + y; }
+};
+
+int main() {
+    // balanced tree, for heterogeneous sequences
+    {
+        static_assert(hana::experimental::tree_sum(hana::make_tuple(1)) == 1, "");
+        static_assert(hana::experimental::tree_sum(hana::make_tuple(1, 2l, 3, 4l, 5)) == 15, "");
+        static_assert(hana::experimental::tree_product(hana::make_tuple(1, 2l, 3, 4l, 5)) == 120, "");
+        static_assert(hana::experimental::tree_maximum(hana::make_tuple(1, 5l, 3, 4l, 2)) == 5, "");
+        static_assert(hana::experimental::tree_minimum(hana::make_tuple(3, 5l, 1, 4l, 2)) == 1, "");
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::experimental::tree_sum(hana::make_tuple(hana::int_c<1>, hana::int_c<2>, hana::int_c<3>)),
+            hana::int_c<6>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::experimental::tree_maximum(hana::make_tuple(hana::int_c<1>, hana::int_c<3>, hana::int_c<2>)),
+            hana::int_c<3>
+        ));
+
+        // the order of the elements is preserved
+        auto strings = hana::make_tuple(std::string{"a"}, std::string{"b"}, std::string{"c"},
+                                        std::string{"d"}, std::string{"e"});
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_fold(strings, concat{}) == "abcde");
+    }
+
+    // several accumulators, for large homogeneous sequences
+    {
+        constexpr auto xs = iota<long>(std::make_index_sequence<100>{});
+        static_assert(hana::experimental::tree_sum(xs) == 4950, "");
+        static_assert(hana::experimental::tree_maximum(xs) == 99, "");
+        static_assert(hana::experimental::tree_minimum(xs) == 0, "");
+
+        constexpr std::array<int, 20> ys{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+        static_assert(hana::experimental::tree_product(ys) == 3628800, "");
+        static_assert(hana::experimental::tree_sum(ys) == hana::fold_left(ys, 0, hana::plus), "");
+
+        std::array<std::string, 35> strings;
+        std::string expected;
+        for (std::size_t i = 0; i != strings.size(); ++i) {
+            strings[i] = std::string(1, static_cast<char>('A' + i));
+            expected += strings[i];
+        }
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_fold(strings, concat{}) == expected);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_fold(std::move(strings), concat{}) == expected);
+    }
+
+    // floating point numbers
+    {
+        std::array<double, 1001> xs;
+        for (std::size_t i = 0; i != xs.size(); ++i)
+            xs[i] = static_cast<double>(i % 10) - 4.5;
+        xs[500] = 100.0;
+        xs[700] = -100.0;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_sum(xs) == hana::fold_left(xs, hana::plus));
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_maximum(xs) == 100.0);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_minimum(xs) == -100.0);
+    }
+}
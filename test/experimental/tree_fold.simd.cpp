@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#define BOOST_HANA_CONFIG_ENABLE_SIMD
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/tree_fold.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/minimum.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T, std::size_t N>
+void check(std::array<T, N> const& xs) {
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_sum(xs) == hana::fold_left(xs, hana::plus));
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_product(xs) == hana::fold_left(xs, hana::mult));
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_maximum(xs) == hana::maximum(xs));
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_minimum(xs) == hana::minimum(xs));
+}
+
+template <typename T, std::size_t N>
+std::array<T, N> make_array() {
+    std::array<T, N> xs;
+    for (std::size_t i = 0; i != N; ++i)
+        xs[i] = static_cast<T>(i % 3 == 0 ? 1 : i % 3 == 1 ? 2 : -1);
+    xs[N / 2] = 9;
+    xs[N / 3] = -7;
+    return xs;
+}
+
+int main() {
+    // every size around the width of a vector register, and longer ones
+    check(make_array<float, 16>());
+    check(make_array<float, 17>());
+    check(make_array<float, 23>());
+    check(make_array<float, 24>());
+    check(make_array<float, 1001>());
+    check(make_array<double, 16>());
+    check(make_array<double, 19>());
+    check(make_array<double, 1001>());
+    check(make_array<int, 33>());
+    check(make_array<std::int64_t, 37>());
+    check(make_array<std::int16_t, 100>());
+
+    {
+        auto xs = hana::make_tuple(1., 2., 3., 4., 5., 6., 7., 8., 9., 10.,
+                                   1., 2., 3., 4., 5., 6., 7., 8., 9., 10.);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_sum(xs) == 110.);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_maximum(xs) == 10.);
+    }
+
+    // functions without a vectorized implementation are still supported
+    {
+        std::array<std::string, 20> strings;
+        std::string expected;
+        for (std::size_t i = 0; i != strings.size(); ++i) {
+            strings[i] = std::string(1, static_cast<char>('A' + i));
+            expected += strings[i];
+        }
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::tree_fold(strings,
+            [](std::string const& x, std::string const& y) { return x + y; }
+        ) == expected);
+    }
+}
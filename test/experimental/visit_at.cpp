@@ -0,0 +1,97 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/experimental/visit_at.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct to_string {
+    std::string& out;
+    void operator()(int i) const { out = "int " + std::to_string(i); }
+    void operator()(char c) const { out = std::string{"char "} + c; }
+    void operator()(std::string const& s) const { out = "string " + s; }
+};
+
+int main() {
+    auto xs = hana::make_tuple(1, 'x', std::string{"abc"});
+
+    // the element at the given index is passed to the function
+    {
+        std::string visited;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(xs, 0, to_string{visited}));
+        BOOST_HANA_RUNTIME_CHECK(visited == "int 1");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(xs, 1, to_string{visited}));
+        BOOST_HANA_RUNTIME_CHECK(visited == "char x");
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(xs, 2, to_string{visited}));
+        BOOST_HANA_RUNTIME_CHECK(visited == "string abc");
+    }
+
+    // the function is not called when the index is out of bounds
+    {
+        bool visited = false;
+        auto record = [&](auto const&) { visited = true; };
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(xs, 3, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(xs, static_cast<std::size_t>(-1), record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(xs, -1, record));
+#ifdef __SIZEOF_INT128__
+        __extension__ typedef unsigned __int128 uint128;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(xs, (static_cast<uint128>(1) << 64) + 1, record));
+#endif
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_at(hana::make_tuple(), 0, record));
+        BOOST_HANA_RUNTIME_CHECK(!visited);
+    }
+
+    // the elements can be modified
+    {
+        hana::experimental::visit_at(xs, 2, [](auto& x) { x = std::decay_t<decltype(x)>{}; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs).empty());
+    }
+
+    // the value category of the sequence is forwarded
+    {
+        auto ys = hana::make_tuple(std::make_unique<int>(3), std::make_unique<int>(4));
+        std::unique_ptr<int> moved;
+        hana::experimental::visit_at(std::move(ys), 0, [&](auto&& y) {
+            static_assert(std::is_rvalue_reference<decltype(y)>{}, "");
+            moved = std::move(y);
+        });
+        BOOST_HANA_RUNTIME_CHECK(*moved == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == nullptr);
+
+        auto const& cys = ys;
+        hana::experimental::visit_at(cys, 1, [](auto&& y) {
+            static_assert(std::is_const<std::remove_reference_t<decltype(y)>>{}, "");
+        });
+    }
+
+    // other Iterables
+    {
+        int sum = 0;
+        std::array<int, 3> array = {{1, 2, 3}};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(array, 2, [&](int i) { sum += i; }));
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(hana::make_basic_tuple(10, 20), 1, [&](int i) {
+            sum += i;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(sum == 23);
+    }
+
+    // without bounds checking
+    {
+        std::string visited;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_at(xs, 1, to_string{visited},
+                                                              hana::experimental::unchecked));
+        BOOST_HANA_RUNTIME_CHECK(visited == "char x");
+    }
+}
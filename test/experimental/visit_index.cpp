@@ -0,0 +1,86 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/visit_index.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+
+#include <cstddef>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+int main() {
+    // the matching IntegralConstant is passed to the function
+    {
+        int visited = -1;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, 0, 5>, 3, [&](auto n) {
+            static_assert(std::is_same<typename decltype(n)::value_type, int>{}, "");
+            visited = decltype(n)::value;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visited == 3);
+
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, 0, 5>, 0, [&](auto n) {
+            visited = decltype(n)::value;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visited == 0);
+    }
+
+    // ranges not starting at 0
+    {
+        int visited = 0;
+        auto record = [&](auto n) { visited = decltype(n)::value; };
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, -3, 2>, -3, record));
+        BOOST_HANA_RUNTIME_CHECK(visited == -3);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, -3, 2>, 1, record));
+        BOOST_HANA_RUNTIME_CHECK(visited == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<long, 10, 20>, 15, record));
+        BOOST_HANA_RUNTIME_CHECK(visited == 15);
+    }
+
+    // the function is not called when the integer is out of the range
+    {
+        bool visited = false;
+        auto record = [&](auto) { visited = true; };
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, 0, 5>, 5, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, 0, 5>, -1, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, -3, 2>, -4, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, -3, 2>, 2, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<unsigned, 2, 4>, 1u, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, 0, 0>, 0, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, -3, 2>, static_cast<std::size_t>(-1), record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<unsigned, 2, 4>, -1, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<unsigned long long, 2, 4>, (1ll << 40) + 2, record));
+        BOOST_HANA_RUNTIME_CHECK(!visited);
+    }
+
+#ifdef __SIZEOF_INT128__
+    // indices wider than std::size_t are not truncated
+    {
+        __extension__ typedef __int128 int128;
+        bool visited = false;
+        auto record = [&](auto) { visited = true; };
+        int128 const wide = (static_cast<int128>(1) << 64) + 1;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, 0, 5>, wide, record));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_index(hana::range_c<int, 0, 5>, -wide, record));
+        BOOST_HANA_RUNTIME_CHECK(!visited);
+
+        int index = -1;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, -3, 2>, static_cast<int128>(-2), [&](auto n) {
+            index = decltype(n)::value;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(index == -2);
+    }
+#endif
+
+    // without bounds checking
+    {
+        int visited = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_index(hana::range_c<int, 1, 4>, 2, [&](auto n) {
+            visited = decltype(n)::value;
+        }, hana::experimental::unchecked));
+        BOOST_HANA_RUNTIME_CHECK(visited == 2);
+    }
+}
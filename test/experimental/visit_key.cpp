@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/visit_key.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+int main() {
+    auto keys = hana::make_tuple(BOOST_HANA_STRING("abc"),
+                                 BOOST_HANA_STRING("def"),
+                                 BOOST_HANA_STRING(""));
+
+    // the matching key is passed to the function
+    {
+        std::string visited = "none";
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_key(keys, std::string{"def"}, [&](auto key) {
+            visited = hana::to<char const*>(key);
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visited == "def");
+
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_key(keys, "", 0, [&](auto key) {
+            visited = hana::to<char const*>(key);
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visited == "");
+    }
+
+    // the function is not called when no key matches
+    {
+        bool visited = false;
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_key(keys, std::string{"ab"}, [&](auto) {
+            visited = true;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_key(keys, "abcd", 4, [&](auto) {
+            visited = true;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(!hana::experimental::visit_key(hana::make_tuple(), std::string{}, [&](auto) {
+            visited = true;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(!visited);
+    }
+
+    // keys may be held in any Foldable
+    {
+        auto set = hana::make_set(BOOST_HANA_STRING("x"), BOOST_HANA_STRING("y"));
+        std::string visited;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::visit_key(set, std::string{"y"}, [&](auto key) {
+            visited = hana::to<char const*>(key);
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visited == "y");
+    }
+
+    // elements of a map
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("one"), 1),
+            hana::make_pair(BOOST_HANA_STRING("two"), 2)
+        );
+        int value = 0;
+        hana::experimental::visit_key(hana::keys(map), std::string{"two"}, [&](auto key) {
+            value = map[key];
+        });
+        BOOST_HANA_RUNTIME_CHECK(value == 2);
+    }
+
+    // members of a Struct
+    {
+        Person john{"John", 30};
+        hana::experimental::visit_key(hana::keys(john), std::string{"age"}, [&](auto key) {
+            auto& member = hana::at_key(john, key);
+            member = {};
+        });
+        BOOST_HANA_RUNTIME_CHECK(john.age == 0);
+        BOOST_HANA_RUNTIME_CHECK(john.name == "John");
+    }
+}
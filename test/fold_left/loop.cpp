@@ -0,0 +1,92 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+//
+// Make sure that fold_left gives the same results when it is implemented
+// with a loop, i.e. for large sequences of elements with the same type.
+//
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>)
+{ return hana::make_tuple(static_cast<T>(i)...); }
+
+struct minus {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return x - y; }
+};
+
+int main() {
+    constexpr auto xs = iota<long>(std::make_index_sequence<100>{});
+    static_assert(hana::detail::use_loop<decltype(xs)&>::value, "");
+
+    // with state
+    {
+        static_assert(hana::fold_left(xs, 0l, minus{}) == -4950, "");
+        static_assert(hana::fold_left(xs, 0, minus{}) == -4950, "");
+
+        // the state does not have the type of the elements
+        std::string s = hana::fold_left(xs, std::string{}, [](std::string acc, long x) {
+            return acc + static_cast<char>('a' + x % 26);
+        });
+        BOOST_HANA_RUNTIME_CHECK(s.size() == 100);
+        BOOST_HANA_RUNTIME_CHECK(s[27] == 'b');
+
+        // the type of the state changes at each step
+        auto nested = hana::fold_left(hana::make_tuple(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+            14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33),
+            hana::make_tuple(), [](auto acc, int x) { return hana::append(acc, x); });
+        BOOST_HANA_RUNTIME_CHECK(nested == hana::make_tuple(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+            12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33));
+    }
+
+    // without state
+    {
+        static_assert(hana::fold_left(xs, minus{}) == -4950, "");
+    }
+
+    // std::array
+    {
+        constexpr std::array<int, 40> a{{1, 2, 3}};
+        static_assert(hana::fold_left(a, 0, minus{}) == -6, "");
+        static_assert(hana::fold_left(std::array<int, 40>{{1, 2, 3}}, minus{}) == -4, "");
+    }
+
+    // elements are moved out of rvalue sequences
+    {
+        std::array<std::unique_ptr<int>, 40> ptrs;
+        for (auto& p : ptrs)
+            p.reset(new int{1});
+        int total = hana::fold_left(std::move(ptrs), 0, [](int acc, std::unique_ptr<int>&& p) {
+            std::unique_ptr<int> q = std::move(p);
+            return acc + *q;
+        });
+        BOOST_HANA_RUNTIME_CHECK(total == 40);
+        BOOST_HANA_RUNTIME_CHECK(ptrs[39] == nullptr);
+    }
+
+    // returning references falls back to the unrolled implementation
+    {
+        auto ys = iota<int>(std::make_index_sequence<40>{});
+        int state = 99;
+        int& last = hana::fold_left(ys, state, [](int&, int& i) -> int& { return i; });
+        BOOST_HANA_RUNTIME_CHECK(last == 39);
+        last = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<39>(ys) == 0);
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_right.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+//
+// Make sure that fold_right gives the same results when it is implemented
+// with a loop, i.e. for large sequences of elements with the same type.
+//
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>)
+{ return hana::make_tuple(static_cast<T>(i)...); }
+
+struct minus {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return x - y; }
+};
+
+int main() {
+    constexpr auto xs = iota<long>(std::make_index_sequence<100>{});
+    static_assert(hana::detail::use_loop<decltype(xs)&>::value, "");
+
+    // with state
+    {
+        static_assert(hana::fold_right(xs, 0l, minus{}) == -50, "");
+        static_assert(hana::fold_right(xs, 1, minus{}) == -49, "");
+
+        std::string s = hana::fold_right(xs, std::string{}, [](long x, std::string acc) {
+            return acc + static_cast<char>('a' + x % 26);
+        });
+        BOOST_HANA_RUNTIME_CHECK(s.size() == 100);
+        BOOST_HANA_RUNTIME_CHECK(s[0] == 'v');
+        BOOST_HANA_RUNTIME_CHECK(s[99] == 'a');
+    }
+
+    // without state
+    {
+        static_assert(hana::fold_right(xs, minus{}) == -50, "");
+    }
+
+    // std::array
+    {
+        constexpr std::array<int, 40> a{{1, 2, 3}};
+        static_assert(hana::fold_right(a, 0, minus{}) == 2, "");
+        static_assert(hana::fold_right(std::array<int, 40>{{1, 2, 3}}, minus{}) == 2, "");
+    }
+
+    // returning references falls back to the unrolled implementation
+    {
+        auto ys = iota<int>(std::make_index_sequence<40>{});
+        int state = 99;
+        int& first = hana::fold_right(ys, state, [](int& i, int&) -> int& { return i; });
+        BOOST_HANA_RUNTIME_CHECK(first == 0);
+        first = 10;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 10);
+    }
+}
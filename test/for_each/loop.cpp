@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+//
+// Make sure that for_each visits the elements in order and with the right
+// value category when it is implemented with a loop.
+//
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>)
+{ return hana::make_tuple(static_cast<T>(i)...); }
+
+int main() {
+    {
+        auto xs = iota<int>(std::make_index_sequence<100>{});
+        static_assert(hana::detail::use_loop<decltype(xs)&>::value, "");
+
+        std::vector<int> seen;
+        hana::for_each(xs, [&](int x) { seen.push_back(x); });
+        BOOST_HANA_RUNTIME_CHECK(seen.size() == 100);
+        for (int i = 0; i != 100; ++i)
+            BOOST_HANA_RUNTIME_CHECK(seen[i] == i);
+
+        hana::for_each(xs, [](int& x) { x *= 2; });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<99>(xs) == 198);
+    }
+
+    {
+        std::array<std::unique_ptr<int>, 40> ptrs;
+        for (auto& p : ptrs)
+            p.reset(new int{1});
+
+        int total = 0;
+        hana::for_each(ptrs, [&](std::unique_ptr<int> const& p) { total += *p; });
+        BOOST_HANA_RUNTIME_CHECK(total == 40);
+
+        std::vector<std::unique_ptr<int>> moved;
+        hana::for_each(std::move(ptrs), [&](std::unique_ptr<int>&& p) {
+            moved.push_back(std::move(p));
+        });
+        BOOST_HANA_RUNTIME_CHECK(moved.size() == 40);
+        BOOST_HANA_RUNTIME_CHECK(ptrs[0] == nullptr);
+    }
+}
@@ -3,15 +3,34 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
+#include <boost/hana/core/is_a.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
 #include <boost/hana/index_if.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
 
 #include <cstddef>
 #include <support/counter.hpp>
+#include <tuple>
+#include <type_traits>
 
 namespace hana = boost::hana;
 
 
+// Whether `x` is a `hana::type`. Its body can only be instantiated for
+// `hana::type`s, but it is never called by `index_if`, which only needs the
+// type of its result.
+struct is_type {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+        -> hana::bool_<hana::is_a<hana::type_tag, X>()>
+    {
+        (void)sizeof(typename X::type); // ill-formed after the match below
+        return {};
+    }
+};
+
 int main() {
     // Tests hana::index_if on an infinite iterable
     constexpr Counter<> c{};
@@ -28,4 +47,23 @@ int main() {
     static_assert(hana::value(decltype(hana::index_if(c, pred(hana::size_c<4>)).value()){}) == 4, "");
     static_assert(hana::value(decltype(hana::index_if(c, pred(hana::size_c<5>)).value()){}) == 5, "");
     static_assert(hana::value(decltype(hana::index_if(c, pred(hana::size_c<6>)).value()){}) == 6, "");
+
+    // Tests hana::index_if on a sequence of local types
+    {
+        struct A { };
+        struct B { };
+        auto r = hana::index_if(std::make_tuple(A{}, B{}), hana::is_a<hana::type_tag>);
+        static_assert(std::is_same<decltype(r), hana::optional<>>::value, "");
+
+        auto s = hana::index_if(std::make_tuple(A{}, hana::type_c<B>), hana::is_a<hana::type_tag>);
+        static_assert(std::is_same<decltype(s), hana::optional<hana::size_t<1>>>::value, "");
+    }
+
+    // Tests hana::index_if with a predicate whose body is ill-formed for the
+    // elements after the first match. The type of its result is still
+    // computed for every element.
+    {
+        auto r = hana::index_if(std::make_tuple(hana::type_c<int>, 1, '2'), is_type{});
+        static_assert(std::is_same<decltype(r), hana::optional<hana::size_t<0>>>::value, "");
+    }
 }
@@ -8,6 +8,7 @@
 #include <boost/hana/equal.hpp>
 #include <boost/hana/hash.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
 #include <boost/hana/map.hpp>
 #include <boost/hana/not.hpp>
 #include <boost/hana/pair.hpp>
@@ -146,4 +147,36 @@ int main() {
             hana::int_c<42>
         ));
     }
+
+    // with duplicate keys inside a bucket
+    {
+        auto map = hana::to_map(hana::make_tuple(
+            hana::make_pair(key1, hana::int_c<1>),
+            hana::make_pair(hana::int_c<56>, hana::int_c<56>),
+            hana::make_pair(key2, hana::int_c<2>),
+            hana::make_pair(key1, hana::int_c<99>),
+            hana::make_pair(hana::int_c<56>, hana::int_c<99>),
+            hana::make_pair(key2, hana::int_c<99>)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(map),
+            hana::size_c<3>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, key1),
+            hana::int_c<1>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, hana::int_c<56>),
+            hana::int_c<56>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, key2),
+            hana::int_c<2>
+        ));
+    }
 }
@@ -0,0 +1,89 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include <climits>
+namespace hana = boost::hana;
+
+
+// Maps whose keys are all integral constants are looked up by subtracting
+// the smallest key from the key being searched; make sure we handle keys
+// outside of that range, keys of other types and sparse keys properly.
+
+template <int i>
+auto p() { return hana::make_pair(hana::int_c<i>, hana::int_c<-i>); }
+
+int main() {
+    auto map = hana::make_map(p<3>(), p<1>(), p<-1>());
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, hana::int_c<3>), hana::int_c<-3>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, hana::int_c<1>), hana::int_c<-1>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, hana::int_c<-1>), hana::int_c<1>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map, hana::long_c<1>), hana::int_c<-1>));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::int_c<0>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::int_c<2>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::int_c<4>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::int_c<-2>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::uint_c<1>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map, hana::type_c<int>)));
+
+    // inserting inside the range of keys
+    {
+        auto map2 = hana::insert(map, p<0>());
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            map2,
+            hana::make_map(p<3>(), p<1>(), p<-1>(), p<0>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::int_c<0>), hana::int_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map2, hana::int_c<2>)));
+    }
+
+    // inserting outside the range of keys
+    {
+        auto map2 = hana::insert(map, p<100>());
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::int_c<100>), hana::int_c<-100>));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::int_c<3>), hana::int_c<-3>));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::int_c<-1>), hana::int_c<1>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(map2, hana::int_c<0>)));
+    }
+
+    // inserting a key of another type
+    {
+        auto map2 = hana::insert(map, hana::make_pair(hana::type_c<int>, hana::int_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::type_c<int>), hana::int_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(map2, hana::int_c<1>), hana::int_c<-1>));
+    }
+
+    // sparse and extreme keys
+    {
+        auto sparse = hana::make_map(p<0>(), p<1000>());
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(sparse, hana::int_c<1000>), hana::int_c<-1000>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(sparse, hana::int_c<1>)));
+
+        auto extreme = hana::make_map(
+            hana::make_pair(hana::llong_c<LLONG_MIN>, hana::int_c<0>),
+            hana::make_pair(hana::llong_c<LLONG_MAX>, hana::int_c<1>)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(extreme, hana::llong_c<LLONG_MAX>), hana::int_c<1>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(extreme, hana::llong_c<0>)));
+
+        auto unsigned_ = hana::make_map(
+            hana::make_pair(hana::ullong_c<ULLONG_MAX>, hana::int_c<0>),
+            hana::make_pair(hana::ullong_c<ULLONG_MAX - 1>, hana::int_c<1>)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(unsigned_, hana::ullong_c<ULLONG_MAX>), hana::int_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(unsigned_, hana::ullong_c<0>)));
+    }
+}
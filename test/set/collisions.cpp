@@ -0,0 +1,107 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/union.hpp>
+namespace hana = boost::hana;
+
+
+struct A { };
+struct B { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <>
+    struct hash_impl<A> {
+        static constexpr auto apply(A const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct hash_impl<B> {
+        static constexpr auto apply(B const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct equal_impl<A, A> {
+        static constexpr auto apply(A const&, A const&) {
+            return hana::true_c;
+        }
+    };
+
+    template <>
+    struct equal_impl<B, B> {
+        static constexpr auto apply(B const&, B const&) {
+            return hana::true_c;
+        }
+    };
+}}
+
+int main() {
+    constexpr auto key1 = A{};
+    constexpr auto key2 = B{};
+
+    // ensure the hashes actually collide
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::hash(key1), hana::hash(key2)));
+
+    {
+        auto set = hana::make_set(key1, hana::int_c<56>, key2);
+
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key1));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, key2));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, hana::int_c<56>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, hana::int_c<42>)));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::erase_key(set, key1),
+            hana::make_set(hana::int_c<56>, key2)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::erase_key(set, key2),
+            hana::make_set(key1, hana::int_c<56>)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            set,
+            hana::make_set(key2, key1, hana::int_c<56>)
+        ));
+    }
+
+    // with duplicate elements inside a bucket
+    {
+        auto set = hana::to_set(hana::make_tuple(
+            key1, hana::int_c<56>, key2, key1, hana::int_c<56>, key2
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(set),
+            hana::size_c<3>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            set,
+            hana::make_set(key1, hana::int_c<56>, key2)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::union_(hana::make_set(key2), hana::make_set(key1, key2)),
+            hana::make_set(key1, key2)
+        ));
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+//
+// Make sure that transform gives the same results when it is implemented
+// with a loop, i.e. for large sequences of elements with the same type.
+//
+
+template <typename T, std::size_t ...i>
+constexpr auto iota(std::index_sequence<i...>)
+{ return hana::make_tuple(static_cast<T>(i)...); }
+
+struct half {
+    constexpr double operator()(int x) const { return x / 2.0; }
+};
+
+int main() {
+    constexpr auto xs = iota<int>(std::make_index_sequence<100>{});
+
+    {
+        static_assert(hana::detail::transform_loop<
+            hana::tuple_tag, decltype(xs)&, half&
+        >::value, "");
+
+        constexpr auto ys = hana::transform(xs, half{});
+        static_assert(std::is_same<
+            std::remove_const_t<decltype(ys)>,
+            decltype(iota<double>(std::make_index_sequence<100>{}))
+        >::value, "");
+        static_assert(hana::at_c<1>(ys) == 0.5, "");
+        static_assert(hana::at_c<99>(ys) == 49.5, "");
+    }
+
+    // results which are not stored in an array fall back to the unrolled
+    // implementation
+    {
+        auto strings = hana::transform(xs, [](int x) { return std::to_string(x); });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<42>(strings) == "42");
+    }
+}